@@ -2,13 +2,14 @@
 #include <cstdint>
 #include <format>
 #include <iostream>
+#include <vector>
 #include <string_view>
 #include "timecode.hpp"
 
 using namespace __cxxtc;
 using Timecode = BasicTimecode<std::uint32_t>;
 
-auto main() -> int {
+auto main(int argc, char const* argv[]) -> int {
     static constexpr Fps FPS = Fps::F_24;
     static constexpr std::array<std::string_view, 30> TIMECODES = {
         "00:00:01:12",
@@ -43,8 +44,25 @@ auto main() -> int {
         "00:02:25:08",
     };
 
+    // With a path argument, load a newline-delimited timecode file instead.
+    if (argc > 1) {
+        std::vector<std::size_t> rejected_lines;
+        auto const column = TimecodeColumn<std::uint32_t>::from_file(argv[1], FPS, rejected_lines);
+        std::cout << std::format("{}: {} timecodes parsed, {} lines rejected\n", argv[1], column.size(), rejected_lines.size());
+        for (auto const line : rejected_lines) {
+            std::cout << std::format("  rejected line {}\n", line);
+        }
+        return (rejected_lines.empty()) ? 0 : 1;
+    }
+
     for (const auto& tc_string : TIMECODES) {
-        auto const tc = Timecode{ tc_string, FPS };
+        auto const ticks = Timecode::timecode_to_ticks(tc_string, FPS);
+        if (!ticks) {
+            std::cout << std::format("{} => invalid\n", tc_string);
+            continue;
+        }
+
+        auto const tc = Timecode::from_ticks_unchecked(*ticks, FPS);
         std::cout << std::format(
             "{} => hours: {:>2}, minutes: {:>2}, seconds: {:>2}, frames: {:>2}, ticks: {:>3}\n",
             tc_string, tc.hours_part(), tc.minutes_part(), tc.seconds_part(), tc.frames_part(), tc.ticks_part()
@@ -1,20 +1,37 @@
 #ifndef CXXTC_TIMECODE_HPP
 #define CXXTC_TIMECODE_HPP
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <chrono>
 #include <compare>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <expected>
+#include <functional>
 #include <optional>
+#include <ranges>
 #include <span>
+#include <stop_token>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 #include <stdexcept>
 #include <format>
+#include <iterator>
 #include <limits>
+#include <mutex>
+#include <numeric>
+#include <thread>
 
 // -----------------------------------------------------------------------------
 //
@@ -56,8 +73,8 @@
         static constexpr const char* type_name = LITERAL(type);                                                   \
         enum Variant : underlying_type variants;                                                                  \
         __VA_ARGS__                                                                                               \
-        constexpr type(Variant variant) : _variant(variant) {}                                                    \
-        constexpr type(type const& other) : _variant(other._variant) {}                                           \
+        constexpr type(Variant variant) noexcept : _variant(variant) {}                                           \
+        constexpr type(type const& other) noexcept : _variant(other._variant) {}                                  \
         ENUM_THREE_WAY_OPERATOR(type, _variant)                                                                   \
         inline constexpr void operator=(Variant variant)  { _variant = variant; }                                 \
         inline constexpr underlying_type as_underlying() const { return static_cast<underlying_type>(_variant); } \
@@ -92,9 +109,22 @@ namespace __cxxtc {
         ),
 
         ENUM_BODY(
-            // TODO: handle truncation of fractional values
+            // Nominal rate that labels count at; the exact rate of the
+            // fractional rates is rate_numerator() / rate_denominator().
             template<std::unsigned_integral T>
             static constexpr T to_unsigned(Fps fps) {
+                auto const value = to_unsigned_or_zero<T>(fps);
+                if (value == 0) {
+                    // TODO: formatter for enums
+                    CXXTC_THROW(std::format("unknown fps type with value: {}", fps.as_underlying()));
+                }
+                return value;
+            }
+
+            // As to_unsigned(), but 0 for an unknown rate rather than a
+            // throw, for the exception-free paths.
+            template<std::unsigned_integral T>
+            static constexpr T to_unsigned_or_zero(Fps fps) noexcept {
                  switch (fps) {
                     case F_23P976_DF:
                     case F_23P976_NDF: return 24;
@@ -107,14 +137,105 @@ namespace __cxxtc {
                     case F_29P97_NDF:
                     case F_30: return 30;
 
-                    // TODO: formatter for enums
-                    default: CXXTC_THROW(std::format("unknown fps type with value: {}", fps.as_underlying()));
+                    default: return 0;
                  }
             }
 
+            // Exact frame rate as the fraction rate_numerator() over
+            // rate_denominator(), e.g. 24000/1001 for 23.976.
+            template<std::unsigned_integral T>
+            static constexpr T rate_numerator(Fps fps) {
+                return (rate_denominator<T>(fps) == 1) ? to_unsigned<T>(fps) : to_unsigned<T>(fps) * 1000;
+            }
+
+            template<std::unsigned_integral T>
+            static constexpr T rate_denominator(Fps fps) {
+                switch (fps) {
+                    case F_23P976_DF:
+                    case F_23P976_NDF:
+                    case F_29P97_DF:
+                    case F_29P97_NDF: return 1001;
+
+                    default: return 1;
+                }
+            }
+
             inline static constexpr bool drop_frame(Fps fps) {
                 return fps >= 100;
             }
+
+            // Frame numbers skipped at the start of every minute that is not
+            // a multiple of ten. SMPTE 12M only defines drop-frame counting
+            // for 29.97, so 23.976 drop-frame labels count like non-drop.
+            template<std::unsigned_integral T>
+            inline static constexpr T dropped_frames(Fps fps) {
+                return (fps == F_29P97_DF) ? 2 : 0;
+            }
+        )
+    );
+
+    DECLARE_ENUM(TimecodeForm, std::uint8_t,
+        ENUM_VARIANTS(
+            REGULAR,
+            EXTENDED,
+        )
+    );
+
+    // Presets for the number of ticks per frame of BasicTimecode. MILLIFRAME
+    // is the default. At integer frame rates the sample presets give every
+    // 48/96 kHz audio sample a whole number of ticks. The power-of-two
+    // presets split frames and ticks with a shift and a mask; POW2_65536
+    // needs 64-bit ticks to hold a whole day.
+    struct TickRates {
+        static constexpr std::uint32_t MILLIFRAME = 1000;
+        static constexpr std::uint32_t SAMPLES_48K = 48000;
+        static constexpr std::uint32_t SAMPLES_96K = 96000;
+        static constexpr std::uint32_t POW2_1024 = 1024;
+        static constexpr std::uint32_t POW2_65536 = 65536;
+    };
+
+    // How a time that falls between two frames is moved onto one.
+    DECLARE_ENUM(SnapMode, std::uint8_t,
+        ENUM_VARIANTS(
+            FLOOR,
+            NEAREST,
+            CEIL,
+        )
+    );
+
+    // Why a timecode string failed to parse; see BasicTimecode::parse().
+    // DROPPED_FRAME is a label that drop-frame counting skips. A plain enum
+    // rather than DECLARE_ENUM, whose types cannot be moved, as
+    // std::expected requires of its error type.
+    enum class ParseError : std::uint8_t {
+        BAD_LENGTH,
+        NOT_A_DIGIT,
+        BAD_DELIMITER,
+        OUT_OF_RANGE,
+        DROPPED_FRAME,
+        UNKNOWN_RATE,
+    };
+
+    constexpr std::string_view parse_error_name(ParseError error) noexcept {
+        switch (error) {
+            case ParseError::BAD_LENGTH: return "bad length";
+            case ParseError::NOT_A_DIGIT: return "not a digit";
+            case ParseError::BAD_DELIMITER: return "bad delimiter";
+            case ParseError::OUT_OF_RANGE: return "field out of range";
+            case ParseError::DROPPED_FRAME: return "dropped frame label";
+            case ParseError::UNKNOWN_RATE: return "unknown frame rate";
+        }
+        return "unknown parse error";
+    }
+
+    // How arithmetic handles results outside [0, TICKS_MAX(fps)]: WRAP wraps
+    // modulo 24 hours, SATURATE clamps to the range, and REPORT rejects the
+    // result and reports it to the caller.
+    DECLARE_ENUM(OverflowPolicy, std::uint8_t,
+        ENUM_VARIANTS(
+            WRAP,
+            SATURATE,
+            REPORT,
         )
     );
 
@@ -125,469 +246,4402 @@ namespace __cxxtc {
 
 // -----------------------------------------------------------------------------
 //
-// -- @SECTION BasicTimecode Implementation --
+// -- @SECTION Text Helpers --
 //
 // -----------------------------------------------------------------------------
 
-namespace __cxxtc {
+namespace __cxxtc::__text {
 
-#define CXXTC_TICK_RATE_DEFAULT 1000
-#define CXXTC_TICKS_DEFAULT 0
-#define CXXTC_FLAG_DEFAULT 0b00000000
-#define CXXTC_FLAG_DROPFRAME 0b00000001
-#define CXXTC_REGULAR_FORM_SIZE 11
-#define CXXTC_EXTENDED_FORM_SIZE 15
-#define CXXTC_HRS_BEGIN_INDEX 0
-#define CXXTC_MINS_BEGIN_INDEX 3
-#define CXXTC_SECS_BEGIN_INDEX 6
-#define CXXTC_FRAMES_BEGIN_INDEX 9
-#define CXXTC_TICKS_BEGIN_INDEX 12
-#define CXXTC_HRS_MAX 24
-#define CXXTC_MINS_MAX 59
-#define CXXTC_SECS_MAX 59
-#define CXXTC_1HR_TICKS(fps, ticks) (60 * 60 * (fps) * (ticks))
-#define CXXTC_1MIN_TICKS(fps, ticks) (60 * (fps) * (ticks))
-#define CXXTC_1SEC_TICKS(fps, ticks) ((fps) * (ticks))
-#define CXXTC_1FRAME_TICKS(ticks) ((ticks))
+    // "00" through "99", back to back, so that a two-digit field can be
+    // written with a single lookup instead of a divide and a modulo.
+    inline constexpr std::array<char, 200> TWO_DIGITS = []() constexpr {
+        std::array<char, 200> digits = {};
+        for (std::size_t i = 0; i < 100; ++i) {
+            digits[i * 2 + 0] = static_cast<char>('0' + i / 10);
+            digits[i * 2 + 1] = static_cast<char>('0' + i % 10);
+        }
+        return digits;
+    }();
 
-// TODO: static interface assertion with concept
-template<std::unsigned_integral IntType>
-struct BasicTimecode {
-    using fps_enum_type = __cxxtc::Fps;
-    using fps_variant_type = __cxxtc::Fps::Variant;
-    using fps_type = fps_enum_type;
-    using ticks_type = IntType;
-    using flags_type = std::uint8_t;
-    using string_type = std::string;
-    using string_view_type = std::string_view;
+    inline constexpr char* write_two_digits(char* out, std::size_t value) noexcept {
+        out[0] = TWO_DIGITS[value * 2 + 0];
+        out[1] = TWO_DIGITS[value * 2 + 1];
+        return out + 2;
+    }
 
-    template<typename T, std::size_t N>
-    using span_type = std::span<T, N>;
+    inline constexpr char* write_three_digits(char* out, std::size_t value) noexcept {
+        out[0] = static_cast<char>('0' + value / 100);
+        return write_two_digits(out + 1, value % 100);
+    }
 
-    template<std::integral T, std::size_t N>
-    using array_type = std::array<T, N>;
+    // NOTE: Hours are only out of range for timecodes constructed through the
+    // unchecked factories, but must never index past the digit table.
+    inline constexpr char* write_timecode(
+        char* out,
+        std::size_t hours,
+        std::size_t minutes,
+        std::size_t seconds,
+        std::size_t frames,
+        std::size_t ticks,
+        bool extended,
+        char frames_delimiter
+    ) noexcept {
+        out = write_two_digits(out, hours % 100);
+        *out++ = ':';
+        out = write_two_digits(out, minutes);
+        *out++ = ':';
+        out = write_two_digits(out, seconds);
+        *out++ = frames_delimiter;
+        out = write_two_digits(out, frames);
 
-    template<std::integral T>
-    using dynamic_array_type = std::vector<T>;
+        if (extended) {
+            *out++ = '.';
+            out = write_three_digits(out, ticks);
+        }
 
-    static constexpr ticks_type TICK_RATE = ticks_type{CXXTC_TICK_RATE_DEFAULT};
-    static constexpr auto TICKS_MAX = [](fps_type fps) constexpr { return CXXTC_HRS_MAX * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE); };
+        return out;
+    }
 
-public:
-    constexpr BasicTimecode() = delete;
+    // The ".TTT" field of the extended form counts thousandths of a frame.
+    inline constexpr std::size_t SUBFRAME_RATE = 1000;
 
-    constexpr BasicTimecode(fps_type fps) noexcept
-        : _fps(fps)
-        , _ticks(CXXTC_TICKS_DEFAULT)
-        , _flags(CXXTC_FLAG_DEFAULT)
-    {}
+} // @END of namespace __cxxtc::__text
 
-    constexpr BasicTimecode(string_view_type tc, fps_type fps)
-        : _fps(fps)
-        , _ticks(CXXTC_TICKS_DEFAULT)
-        , _flags(CXXTC_FLAG_DEFAULT)
-    {
-        auto const ticks_result = BasicTimecode::timecode_to_ticks(tc, fps);
-        if (!ticks_result.has_value()) {
-            CXXTC_THROW(std::format("failed to construct timecode from string \"{}\" with fps value \"{}\"", tc, fps.as_underlying()));
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION Arithmetic Helpers --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc::__arith {
+
+    // Multiply-and-shift replacement for an unsigned division by a divisor
+    // that is only known at run time, exact for every numerator below
+    // 2^bits (Granlund & Montgomery). Trailing zero bits of the divisor are
+    // shifted out of the numerator first, which keeps the multiplier within
+    // 32 bits so that the same constants can drive the SIMD kernels.
+    struct Reciprocal {
+        std::uint32_t divisor;
+        std::uint32_t multiplier;
+        std::uint32_t pre_shift;
+        std::uint32_t shift;
+
+        static constexpr Reciprocal make(std::uint32_t divisor, std::uint32_t bits) noexcept {
+            CXXTC_ASSERT(divisor != 0);
+            std::uint32_t pre_shift = 0;
+            while (((divisor >> pre_shift) & 1u) == 0) { ++pre_shift; }
+
+            auto const odd = divisor >> pre_shift;
+            if (odd == 1) {
+                // Powers of two, including 1, divide by the pre-shift alone.
+                return Reciprocal{ .divisor = divisor, .multiplier = 1, .pre_shift = pre_shift, .shift = 0 };
+            }
+
+            auto const reduced_bits = bits - pre_shift;
+            CXXTC_ASSERT(reduced_bits <= 30);
+
+            std::uint32_t log2 = 0;
+            while ((std::uint64_t{1} << log2) < odd) { ++log2; }
+
+            auto const shift = reduced_bits + log2;
+            auto const multiplier = ((std::uint64_t{1} << shift) + odd - 1) / odd;
+            return Reciprocal{
+                .divisor = divisor,
+                .multiplier = static_cast<std::uint32_t>(multiplier),
+                .pre_shift = pre_shift,
+                .shift = shift,
+            };
         }
-        _ticks = ticks_result.value();
+
+        constexpr std::uint32_t divide(std::uint32_t n) const noexcept {
+            return static_cast<std::uint32_t>((std::uint64_t{n >> pre_shift} * multiplier) >> shift);
+        }
+    };
+
+    // Drop-frame counting: dropped frame numbers are skipped at the start of
+    // every minute, except every tenth minute, so that labels at a nominal
+    // rate stay in step with real time at rate * 1000/1001.
+    template<std::unsigned_integral T>
+    constexpr T drop_frame_offset(T total_minutes, T dropped) noexcept {
+        return dropped * (total_minutes - total_minutes / 10);
     }
 
-private:
-    explicit constexpr BasicTimecode(fps_type fps, ticks_type ticks, flags_type flags) noexcept
-        : _fps(fps)
-        , _ticks(ticks)
-        , _flags(flags)
-    {}
+    template<std::unsigned_integral T>
+    constexpr bool drop_frame_label_valid(T minutes, T seconds, T frames, T dropped) noexcept {
+        return seconds != 0 || frames >= dropped || minutes % 10 == 0;
+    }
 
-public:
-    static constexpr std::optional<ticks_type> timecode_to_ticks(string_view_type tc, fps_type fps) noexcept {
-        auto const tc_size = tc.size();
-        if (tc_size != CXXTC_REGULAR_FORM_SIZE && tc_size != CXXTC_EXTENDED_FORM_SIZE) {
-            return std::nullopt;
+    // Maps a real frame count onto the frame count of its label at the
+    // nominal rate fps, in O(1).
+    template<std::unsigned_integral T>
+    constexpr T drop_frame_to_label(T frames, T fps, T dropped) noexcept {
+        if (dropped == 0) { return frames; }
+        T const per_minute = fps * 60 - dropped;
+        T const per_ten_minutes = fps * 600 - dropped * 9;
+        auto const tens = frames / per_ten_minutes;
+        auto const rest = frames % per_ten_minutes;
+        return frames + dropped * 9 * tens + dropped * ((std::max(rest, dropped) - dropped) / per_minute);
+    }
+
+    // Reciprocals for splitting ticks into the parts of a timecode at one
+    // frame rate; the chain is ticks / tick rate / fps / 60 / 60. Each
+    // numerator in the chain is bounded by the 32-bit ticks it was derived
+    // from, which is what the reciprocals are made exact for.
+    struct DecomposeReciprocals {
+        Reciprocal tick_rate;
+        Reciprocal fps;
+        Reciprocal sixty;
+
+        // Drop-frame only; frames dropped per minute, and the real number of
+        // frames in one and in ten minutes.
+        std::uint32_t dropped;
+        Reciprocal minute;
+        Reciprocal ten_minutes;
+
+        // Tick rates below 4 would need more frame bits than a reciprocal can
+        // be exact for, so their chain only covers ticks below
+        // 2^RECIPROCAL_BITS_MAX * tick_rate.
+        static constexpr std::uint32_t RECIPROCAL_BITS_MAX = 30;
+
+        static constexpr DecomposeReciprocals make(std::uint32_t tick_rate, std::uint32_t fps, std::uint32_t dropped = 0) noexcept {
+            // NOTE: Drop-frame labels count at most 0.1% further than the real
+            // frames, which never needs another bit.
+            std::uint32_t frames_bits = 1;
+            while ((std::uint64_t{1} << frames_bits) * tick_rate <= std::numeric_limits<std::uint32_t>::max()) { ++frames_bits; }
+            frames_bits = std::min(frames_bits, RECIPROCAL_BITS_MAX);
+
+            return DecomposeReciprocals{
+                .tick_rate = Reciprocal::make(tick_rate, 32),
+                .fps = Reciprocal::make(fps, frames_bits),
+                .sixty = Reciprocal::make(60, frames_bits),
+                .dropped = dropped,
+                .minute = Reciprocal::make(fps * 60 - dropped, frames_bits),
+                .ten_minutes = Reciprocal::make(fps * 600 - dropped * 9, frames_bits),
+            };
         }
 
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        constexpr std::uint32_t to_label(std::uint32_t frames) const noexcept {
+            if (dropped == 0) { return frames; }
+            auto const tens = ten_minutes.divide(frames);
+            auto const rest = frames - tens * ten_minutes.divisor;
+            return frames + dropped * 9 * tens + dropped * minute.divide(std::max(rest, dropped) - dropped);
+        }
 
-        for (std::size_t i = 0; i < tc_size; i += 3) {
-            auto const first_char = tc[i + 0];
-            auto const second_char = tc[i + 1];
+        // Hours, minutes, seconds, frames and ticks of the label, in that
+        // order.
+        constexpr std::array<std::uint32_t, 5> decompose(std::uint32_t value) const noexcept {
+            auto const real_frames = tick_rate.divide(value);
+            return decompose_frames(real_frames, value - real_frames * tick_rate.divisor);
+        }
 
-            // NOTE: In the regular form, size of tc_string is NOT a multiple
-            // of 3, and we do not assume that the user has provided us with a
-            // valid null-terminated string, therefore, we explicitly terminate
-            // with a null-byte.
-            auto const third_char = (tc_size == CXXTC_EXTENDED_FORM_SIZE || i < CXXTC_FRAMES_BEGIN_INDEX)
-                ? tc[i + 2]
-                : '\0';
+        // Same as decompose(), for a value already split into real frames
+        // and the ticks into the frame.
+        constexpr std::array<std::uint32_t, 5> decompose_frames(std::uint32_t real_frames, std::uint32_t ticks) const noexcept {
+            auto const total_frames = to_label(real_frames);
+            auto const total_seconds = fps.divide(total_frames);
+            auto const total_minutes = sixty.divide(total_seconds);
+            auto const hours = sixty.divide(total_minutes);
+            return {
+                hours,
+                total_minutes - hours * 60,
+                total_seconds - total_minutes * 60,
+                total_frames - total_seconds * fps.divisor,
+                ticks,
+            };
+        }
+    };
+
+    // Exact rational scale x * numerator / denominator, reduced to lowest
+    // terms, with bias selecting the snap mode. x is split into whole
+    // multiples of the denominator and a remainder, so every intermediate
+    // stays within 64 bits as long as numerator * denominator and the result
+    // do.
+    struct ExactScale {
+        std::uint64_t numerator;
+        std::uint64_t denominator;
+        std::uint64_t bias;
+
+        static constexpr ExactScale make(std::uint64_t numerator, std::uint64_t denominator, SnapMode snap) {
+            auto const divisor = std::gcd(numerator, denominator);
+            numerator /= divisor;
+            denominator /= divisor;
+            CXXTC_ASSERT(denominator <= std::numeric_limits<std::uint64_t>::max() / numerator);
 
-            if (!('0' <= first_char && first_char <= '9') && !('0' <= second_char && second_char <= '9')) {
-                return std::nullopt;
+            std::uint64_t bias = 0;
+            switch (snap) {
+                case SnapMode::NEAREST: bias = denominator / 2; break;
+                case SnapMode::CEIL: bias = denominator - 1; break;
+                default: break;
             }
 
-            auto const last_is_not_number = !('0' <= third_char && third_char <= '9');
-            auto const last_is_not_delimiter = (i == CXXTC_SECS_BEGIN_INDEX)
-                ? (third_char != ':' && third_char != ';')
-                : (i == CXXTC_FRAMES_BEGIN_INDEX)
-                    ? (tc_size == CXXTC_EXTENDED_FORM_SIZE)
-                        ? (third_char != '.')
-                        : (third_char != '\0')
-                    : third_char != ':';
+            return ExactScale{ numerator, denominator, bias };
+        }
 
-            if ((i == CXXTC_TICKS_BEGIN_INDEX) ? last_is_not_number : last_is_not_delimiter) { return std::nullopt; }
+        inline constexpr std::uint64_t apply(std::uint64_t x) const noexcept {
+            return x / denominator * numerator + (x % denominator * numerator + bias) / denominator;
+        }
+    };
 
-            auto const hundreds = (first_char - '0') * 100u;
-            auto const tens = (i == CXXTC_TICKS_BEGIN_INDEX) ? (second_char - '0') * 10u : (first_char - '0') * 10u;
-            auto const units = (i == CXXTC_TICKS_BEGIN_INDEX) ? (third_char - '0') * 1u : (second_char - '0') * 1u;
-            auto const value = (i == CXXTC_TICKS_BEGIN_INDEX) ? hundreds + tens + units : tens + units;
+    // Exact scale from ticks at one frame rate to whole frames at another,
+    // snapped per the ExactScale bias. Results are returned in ticks of the
+    // target rate, i.e. frames * tick_rate.
+    struct RateRatio {
+        ExactScale frames;
+        std::uint64_t tick_rate;
 
-            switch (i) {
-                case CXXTC_HRS_BEGIN_INDEX: {
-                    if (value > CXXTC_HRS_MAX) { return std::nullopt; }
-                    ticks += value * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+        static constexpr RateRatio make(Fps from, Fps to, std::uint64_t tick_rate, SnapMode snap) {
+            // frames_to = ticks_from / tick_rate * (den_from / num_from) * (num_to / den_to)
+            auto const numerator = Fps::rate_denominator<std::uint64_t>(from) * Fps::rate_numerator<std::uint64_t>(to);
+            auto const denominator = Fps::rate_numerator<std::uint64_t>(from) * Fps::rate_denominator<std::uint64_t>(to) * tick_rate;
+            return RateRatio{ ExactScale::make(numerator, denominator, snap), tick_rate };
+        }
 
-                case CXXTC_MINS_BEGIN_INDEX: {
-                    if (value > CXXTC_MINS_MAX) { return std::nullopt; }
-                    ticks += value * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+        inline constexpr std::uint64_t apply(std::uint64_t ticks) const noexcept {
+            return frames.apply(ticks) * tick_rate;
+        }
+    };
 
-                case CXXTC_SECS_BEGIN_INDEX: {
-                    if (value > CXXTC_SECS_MAX) { return std::nullopt; }
-                    ticks += value * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+    // Full 128-bit product of two 64-bit values, ordered like the number it
+    // holds, for exact comparisons of wide ticks types.
+    struct Wide {
+        std::uint64_t hi;
+        std::uint64_t lo;
 
-                case CXXTC_FRAMES_BEGIN_INDEX: {
-                    if (value >= fps_unsigned) { return std::nullopt; }
-                    ticks += value * CXXTC_1FRAME_TICKS(TICK_RATE);
-                } break;
+        constexpr auto operator<=>(Wide const&) const noexcept = default;
 
-                case CXXTC_TICKS_BEGIN_INDEX: {
-                    if (value >= TICK_RATE) { return std::nullopt; }
-                    ticks += value;
-                } break;
+        static constexpr Wide multiply(std::uint64_t a, std::uint64_t b) noexcept {
+            auto const a_lo = a & 0xffffffff;
+            auto const a_hi = a >> 32;
+            auto const b_lo = b & 0xffffffff;
+            auto const b_hi = b >> 32;
+            auto const lo_lo = a_lo * b_lo;
+            auto const lo_hi = a_lo * b_hi;
+            auto const hi_lo = a_hi * b_lo;
+            auto const mid = (lo_lo >> 32) + (lo_hi & 0xffffffff) + (hi_lo & 0xffffffff);
+            return Wide{ a_hi * b_hi + (lo_hi >> 32) + (hi_lo >> 32) + (mid >> 32), (mid << 32) | (lo_lo & 0xffffffff) };
+        }
+    };
 
-                // unreachable
-                default: return std::nullopt;
+    // Factors that put ticks at two frame rates on a common rational
+    // timebase: lhs_ticks * lhs and rhs_ticks * rhs order exactly like the
+    // real times they stand for. Both factors are reduced to lowest terms.
+    struct CrossScale {
+        std::uint64_t lhs;
+        std::uint64_t rhs;
+
+        static constexpr CrossScale make(Fps lhs, Fps rhs) {
+            // seconds = ticks * rate_denominator / (rate_numerator * tick_rate)
+            auto lhs_scale = Fps::rate_denominator<std::uint64_t>(lhs) * Fps::rate_numerator<std::uint64_t>(rhs);
+            auto rhs_scale = Fps::rate_denominator<std::uint64_t>(rhs) * Fps::rate_numerator<std::uint64_t>(lhs);
+            auto const divisor = std::gcd(lhs_scale, rhs_scale);
+            return CrossScale{ lhs_scale / divisor, rhs_scale / divisor };
+        }
+
+        // Scales below 2^32 keep 32-bit ticks within 64 bits; wider ticks
+        // types use the full 128-bit product.
+        template<std::unsigned_integral T>
+        static constexpr auto key(T ticks, std::uint64_t scale) noexcept {
+            if constexpr (sizeof(T) <= sizeof(std::uint32_t)) {
+                return static_cast<std::uint64_t>(ticks) * scale;
+            } else {
+                return Wide::multiply(ticks, scale);
             }
         }
-        return ticks;
-    }
+    };
 
-    static constexpr ticks_type timecode_to_ticks_unchecked(string_view_type tc, fps_type fps) {
-        auto const tc_size = tc.size();
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+} // @END of namespace __cxxtc::__arith
 
-        for (std::size_t i = 0; i < tc_size; i += 3) {
-            auto const first_char = tc[i + 0];
-            auto const second_char = tc[i + 1];
+// -----------------------------------------------------------------------------
 
-            auto const third_char = (tc_size == CXXTC_EXTENDED_FORM_SIZE || i < CXXTC_FRAMES_BEGIN_INDEX)
-                ? tc[i + 2]
-                : '\0';
 
-            auto const hundreds = (first_char - '0') * 100u;
-            auto const tens = (i == CXXTC_TICKS_BEGIN_INDEX) ? (second_char - '0') * 10u : (first_char - '0') * 10u;
-            auto const units = (i == CXXTC_TICKS_BEGIN_INDEX) ? (third_char - '0') * 1u : (second_char - '0') * 1u;
-            auto const value = (i == CXXTC_TICKS_BEGIN_INDEX) ? hundreds + tens + units : tens + units;
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION SIMD Kernels --
+//
+// -----------------------------------------------------------------------------
 
-            switch (i) {
-                case CXXTC_HRS_BEGIN_INDEX: {
-                    ticks += value * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+#if defined(__AVX2__)
+#define CXXTC_HAS_AVX2 1
+#endif
 
-                case CXXTC_MINS_BEGIN_INDEX: {
-                    ticks += value * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+#if defined(__SSE4_2__)
+#define CXXTC_HAS_SSE42 1
+#endif
 
-                case CXXTC_SECS_BEGIN_INDEX: {
-                    ticks += value * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
-                } break;
+#if defined(CXXTC_HAS_AVX2) || defined(CXXTC_HAS_SSE42)
+#include <immintrin.h>
+#endif
 
-                case CXXTC_FRAMES_BEGIN_INDEX: {
-                    ticks += value * CXXTC_1FRAME_TICKS(TICK_RATE);
-                } break;
+// Byte positions of a timecode string loaded into a 16-byte register, i.e.
+// "HH:MM:SS:FF.TTT", as bitmasks over the register lanes.
+#define CXXTC_SIMD_DIGITS_REGULAR 0b0000011011011011
+#define CXXTC_SIMD_DIGITS_EXTENDED 0b0111011011011011
+#define CXXTC_SIMD_DELIMS_REGULAR 0b0000000100100100
+#define CXXTC_SIMD_DELIMS_EXTENDED 0b0000100100100100
 
-                case CXXTC_TICKS_BEGIN_INDEX: {
-                    ticks += value;
-                } break;
+namespace __cxxtc::__simd {
 
-                default: CXXTC_THROW(std::format("could not parse timecode string \"{}\"", tc));
-            }
-        }
+    struct ParsedFields {
+        std::uint32_t hours;
+        std::uint32_t minutes;
+        std::uint32_t seconds;
+        std::uint32_t frames;
+        std::uint32_t ticks;
+        bool valid;
+    };
+
+#if defined(CXXTC_HAS_SSE42)
+    // Validates one record and folds its digit pairs into 16-bit lanes laid
+    // out as [hrs, mins, secs, frames, ticks hundreds + tens, ticks units].
+    // NOTE: Only the lanes selected by the digit/delimiter masks are
+    // inspected, so anything past the end of the record may be garbage.
+    inline ParsedFields parse_fields_sse42(__m128i raw, bool extended, std::uint32_t fps) noexcept {
+        auto const digits = _mm_sub_epi8(raw, _mm_set1_epi8('0'));
+        auto const is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+
+        // ':' and ';' only differ in the lowest bit, so the separator before
+        // the frames field is masked down to accept both.
+        auto const delim_and = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, ~1, -1, -1, -1, -1, -1, -1, -1);
+        auto const delim_expected = _mm_setr_epi8(0, 0, ':', 0, 0, ':', 0, 0, ':', 0, 0, '.', 0, 0, 0, 0);
+        auto const is_delim = _mm_cmpeq_epi8(_mm_and_si128(raw, delim_and), delim_expected);
 
-        return ticks;
+        auto const digit_bits = extended ? CXXTC_SIMD_DIGITS_EXTENDED : CXXTC_SIMD_DIGITS_REGULAR;
+        auto const delim_bits = extended ? CXXTC_SIMD_DELIMS_EXTENDED : CXXTC_SIMD_DELIMS_REGULAR;
+        auto const found = (_mm_movemask_epi8(is_digit) & digit_bits) | (_mm_movemask_epi8(is_delim) & delim_bits);
+
+        auto const gather = extended
+            ? _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 14, -1, -1, -1, -1, -1)
+            : _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+        auto const weights = _mm_setr_epi8(10, 1, 10, 1, 10, 1, 10, 1, 100, 10, 1, 0, 0, 0, 0, 0);
+        auto const fields = _mm_maddubs_epi16(_mm_shuffle_epi8(digits, gather), weights);
+
+        auto const limits = _mm_setr_epi16(24, 59, 59, static_cast<short>(fps - 1), 999, 9, 0, 0);
+        auto const over = _mm_movemask_epi8(_mm_cmpgt_epi16(fields, limits));
+
+        return ParsedFields {
+            .hours = static_cast<std::uint32_t>(_mm_extract_epi16(fields, 0)),
+            .minutes = static_cast<std::uint32_t>(_mm_extract_epi16(fields, 1)),
+            .seconds = static_cast<std::uint32_t>(_mm_extract_epi16(fields, 2)),
+            .frames = static_cast<std::uint32_t>(_mm_extract_epi16(fields, 3)),
+            .ticks = static_cast<std::uint32_t>(_mm_extract_epi16(fields, 4) + _mm_extract_epi16(fields, 5)),
+            .valid = (found == (digit_bits | delim_bits)) && (over == 0),
+        };
     }
+#endif
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_ticks(T ticks, fps_type fps) noexcept {
-        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-        flags_type flags = (fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
-        return BasicTimecode{ fps, ticks, flags };
+#if defined(CXXTC_HAS_AVX2)
+    // Same as parse_fields_sse42(), but for two records at once; one per
+    // 128-bit lane.
+    inline void parse_fields_x2_avx2(__m128i raw_a, __m128i raw_b, bool extended, std::uint32_t fps, ParsedFields& a, ParsedFields& b) noexcept {
+        auto const raw = _mm256_set_m128i(raw_b, raw_a);
+        auto const digits = _mm256_sub_epi8(raw, _mm256_set1_epi8('0'));
+        auto const is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+
+        auto const delim_and = _mm256_setr_epi8(
+            -1, -1, -1, -1, -1, -1, -1, -1, ~1, -1, -1, -1, -1, -1, -1, -1,
+            -1, -1, -1, -1, -1, -1, -1, -1, ~1, -1, -1, -1, -1, -1, -1, -1
+        );
+        auto const delim_expected = _mm256_setr_epi8(
+            0, 0, ':', 0, 0, ':', 0, 0, ':', 0, 0, '.', 0, 0, 0, 0,
+            0, 0, ':', 0, 0, ':', 0, 0, ':', 0, 0, '.', 0, 0, 0, 0
+        );
+        auto const is_delim = _mm256_cmpeq_epi8(_mm256_and_si256(raw, delim_and), delim_expected);
+
+        std::uint32_t const digit_bits = extended ? CXXTC_SIMD_DIGITS_EXTENDED : CXXTC_SIMD_DIGITS_REGULAR;
+        std::uint32_t const delim_bits = extended ? CXXTC_SIMD_DELIMS_EXTENDED : CXXTC_SIMD_DELIMS_REGULAR;
+        std::uint32_t const expected = (digit_bits | delim_bits) | ((digit_bits | delim_bits) << 16);
+        auto const found = (static_cast<std::uint32_t>(_mm256_movemask_epi8(is_digit)) & (digit_bits | (digit_bits << 16)))
+                         | (static_cast<std::uint32_t>(_mm256_movemask_epi8(is_delim)) & (delim_bits | (delim_bits << 16)));
+        auto const missing = found ^ expected;
+
+        auto const gather = extended
+            ? _mm256_setr_epi8(
+                  0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 14, -1, -1, -1, -1, -1,
+                  0, 1, 3, 4, 6, 7, 9, 10, 12, 13, 14, -1, -1, -1, -1, -1)
+            : _mm256_setr_epi8(
+                  0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1,
+                  0, 1, 3, 4, 6, 7, 9, 10, -1, -1, -1, -1, -1, -1, -1, -1);
+        auto const weights = _mm256_setr_epi8(
+            10, 1, 10, 1, 10, 1, 10, 1, 100, 10, 1, 0, 0, 0, 0, 0,
+            10, 1, 10, 1, 10, 1, 10, 1, 100, 10, 1, 0, 0, 0, 0, 0
+        );
+        auto const fields = _mm256_maddubs_epi16(_mm256_shuffle_epi8(digits, gather), weights);
+
+        auto const frames_max = static_cast<short>(fps - 1);
+        auto const limits = _mm256_setr_epi16(24, 59, 59, frames_max, 999, 9, 0, 0, 24, 59, 59, frames_max, 999, 9, 0, 0);
+        auto const over = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi16(fields, limits)));
+
+        alignas(32) std::array<std::int16_t, 16> lanes;
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), fields);
+
+        a = ParsedFields {
+            .hours = static_cast<std::uint32_t>(lanes[0]),
+            .minutes = static_cast<std::uint32_t>(lanes[1]),
+            .seconds = static_cast<std::uint32_t>(lanes[2]),
+            .frames = static_cast<std::uint32_t>(lanes[3]),
+            .ticks = static_cast<std::uint32_t>(lanes[4] + lanes[5]),
+            .valid = ((missing | over) & 0x0000FFFFu) == 0,
+        };
+
+        b = ParsedFields {
+            .hours = static_cast<std::uint32_t>(lanes[8]),
+            .minutes = static_cast<std::uint32_t>(lanes[9]),
+            .seconds = static_cast<std::uint32_t>(lanes[10]),
+            .frames = static_cast<std::uint32_t>(lanes[11]),
+            .ticks = static_cast<std::uint32_t>(lanes[12] + lanes[13]),
+            .valid = ((missing | over) & 0xFFFF0000u) == 0,
+        };
     }
+#endif
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_ticks_unchecked(T ticks, fps_type fps) {
-        flags_type flags = (fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
-        return BasicTimecode{ fps, ticks, flags };
+    // Hours, minutes, seconds, frames and ticks for N timecodes, one lane per
+    // timecode, as staging for the decompose kernels below.
+    template<std::size_t N>
+    struct DecomposedLanes {
+        alignas(32) std::array<std::uint32_t, N> hours;
+        alignas(32) std::array<std::uint32_t, N> minutes;
+        alignas(32) std::array<std::uint32_t, N> seconds;
+        alignas(32) std::array<std::uint32_t, N> frames;
+        alignas(32) std::array<std::uint32_t, N> ticks;
+    };
+
+#if defined(CXXTC_HAS_SSE42)
+    inline __m128i divide_epu32_sse42(__m128i n, __arith::Reciprocal const& r) noexcept {
+        n = _mm_srl_epi32(n, _mm_cvtsi32_si128(static_cast<int>(r.pre_shift)));
+        auto const multiplier = _mm_set1_epi32(static_cast<int>(r.multiplier));
+        auto const count = _mm_cvtsi32_si128(static_cast<int>(r.shift));
+        auto const even = _mm_srl_epi64(_mm_mul_epu32(n, multiplier), count);
+        auto const odd = _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(n, 32), multiplier), count);
+        return _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0b11001100);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_frames(T frames, fps_type fps) noexcept {
-        ticks_type const ticks = frames * CXXTC_1FRAME_TICKS(TICK_RATE);
-        return BasicTimecode::from_ticks(ticks, fps);
+    inline __m128i drop_frame_to_label_sse42(__m128i frames, __arith::DecomposeReciprocals const& r) noexcept {
+        auto const dropped = _mm_set1_epi32(static_cast<int>(r.dropped));
+        auto const tens = divide_epu32_sse42(frames, r.ten_minutes);
+        auto const rest = _mm_sub_epi32(frames, _mm_mullo_epi32(tens, _mm_set1_epi32(static_cast<int>(r.ten_minutes.divisor))));
+        auto const minutes = divide_epu32_sse42(_mm_sub_epi32(_mm_max_epu32(rest, dropped), dropped), r.minute);
+        auto const offset = _mm_add_epi32(_mm_mullo_epi32(tens, _mm_set1_epi32(static_cast<int>(r.dropped * 9))), _mm_mullo_epi32(minutes, dropped));
+        return _mm_add_epi32(frames, offset);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_frames_unchecked(T frames, fps_type fps) {
-        ticks_type const ticks = frames * CXXTC_1FRAME_TICKS(TICK_RATE);
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    inline void decompose_x4_sse42(
+        std::uint32_t const* ticks,
+        __arith::DecomposeReciprocals const& r,
+        std::uint32_t* hours_out,
+        std::uint32_t* minutes_out,
+        std::uint32_t* seconds_out,
+        std::uint32_t* frames_out,
+        std::uint32_t* ticks_out
+    ) noexcept {
+        auto const n = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ticks));
+        auto const real_frames = divide_epu32_sse42(n, r.tick_rate);
+        auto const total_frames = (r.dropped == 0) ? real_frames : drop_frame_to_label_sse42(real_frames, r);
+        auto const total_seconds = divide_epu32_sse42(total_frames, r.fps);
+        auto const total_minutes = divide_epu32_sse42(total_seconds, r.sixty);
+        auto const hours = divide_epu32_sse42(total_minutes, r.sixty);
+
+        auto const remainder = [](__m128i dividend, __m128i quotient, std::uint32_t divisor) {
+            return _mm_sub_epi32(dividend, _mm_mullo_epi32(quotient, _mm_set1_epi32(static_cast<int>(divisor))));
+        };
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hours_out), hours);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(minutes_out), remainder(total_minutes, hours, 60));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(seconds_out), remainder(total_seconds, total_minutes, 60));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(frames_out), remainder(total_frames, total_seconds, r.fps.divisor));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(ticks_out), remainder(n, real_frames, r.tick_rate.divisor));
     }
+#endif
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_seconds(T seconds, fps_type fps) noexcept {
-        ticks_type const ticks = seconds * CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
-        return BasicTimecode::from_ticks(ticks, fps);
+#if defined(CXXTC_HAS_AVX2)
+    inline __m256i divide_epu32_avx2(__m256i n, __arith::Reciprocal const& r) noexcept {
+        n = _mm256_srl_epi32(n, _mm_cvtsi32_si128(static_cast<int>(r.pre_shift)));
+        auto const multiplier = _mm256_set1_epi32(static_cast<int>(r.multiplier));
+        auto const count = _mm_cvtsi32_si128(static_cast<int>(r.shift));
+        auto const even = _mm256_srl_epi64(_mm256_mul_epu32(n, multiplier), count);
+        auto const odd = _mm256_srl_epi64(_mm256_mul_epu32(_mm256_srli_epi64(n, 32), multiplier), count);
+        return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0b10101010);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_seconds_unchecked(T seconds, fps_type fps) {
-        ticks_type const ticks = seconds * CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    inline __m256i drop_frame_to_label_avx2(__m256i frames, __arith::DecomposeReciprocals const& r) noexcept {
+        auto const dropped = _mm256_set1_epi32(static_cast<int>(r.dropped));
+        auto const tens = divide_epu32_avx2(frames, r.ten_minutes);
+        auto const rest = _mm256_sub_epi32(frames, _mm256_mullo_epi32(tens, _mm256_set1_epi32(static_cast<int>(r.ten_minutes.divisor))));
+        auto const minutes = divide_epu32_avx2(_mm256_sub_epi32(_mm256_max_epu32(rest, dropped), dropped), r.minute);
+        auto const offset = _mm256_add_epi32(_mm256_mullo_epi32(tens, _mm256_set1_epi32(static_cast<int>(r.dropped * 9))), _mm256_mullo_epi32(minutes, dropped));
+        return _mm256_add_epi32(frames, offset);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_minutes(T minutes, fps_type fps) noexcept {
+    inline void decompose_x8_avx2(
+        std::uint32_t const* ticks,
+        __arith::DecomposeReciprocals const& r,
+        std::uint32_t* hours_out,
+        std::uint32_t* minutes_out,
+        std::uint32_t* seconds_out,
+        std::uint32_t* frames_out,
+        std::uint32_t* ticks_out
+    ) noexcept {
+        auto const n = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ticks));
+        auto const real_frames = divide_epu32_avx2(n, r.tick_rate);
+        auto const total_frames = (r.dropped == 0) ? real_frames : drop_frame_to_label_avx2(real_frames, r);
+        auto const total_seconds = divide_epu32_avx2(total_frames, r.fps);
+        auto const total_minutes = divide_epu32_avx2(total_seconds, r.sixty);
+        auto const hours = divide_epu32_avx2(total_minutes, r.sixty);
+
+        auto const remainder = [](__m256i dividend, __m256i quotient, std::uint32_t divisor) {
+            return _mm256_sub_epi32(dividend, _mm256_mullo_epi32(quotient, _mm256_set1_epi32(static_cast<int>(divisor))));
+        };
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(hours_out), hours);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(minutes_out), remainder(total_minutes, hours, 60));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(seconds_out), remainder(total_seconds, total_minutes, 60));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(frames_out), remainder(total_frames, total_seconds, r.fps.divisor));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ticks_out), remainder(n, real_frames, r.tick_rate.divisor));
+    }
+#endif
+
+    // Index of the first of values[from, size) greater than threshold, or
+    // size if there is none. Used to skip runs of sorted range ends that lie
+    // wholly before a point, 8 or 4 lanes at a time where available.
+    inline std::size_t first_greater_epu32(std::uint32_t const* values, std::size_t from, std::size_t size, std::uint32_t threshold) noexcept {
+        auto i = from;
+#if defined(CXXTC_HAS_AVX2)
+        auto const bias = _mm256_set1_epi32(static_cast<int>(0x80000000u));
+        auto const limit = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>(threshold)), bias);
+        for (; i + 8 <= size; i += 8) {
+            auto const lanes = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i)), bias);
+            auto const mask = static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(lanes, limit))));
+            if (mask != 0) { return i + static_cast<std::size_t>(std::countr_zero(mask)); }
+        }
+#elif defined(CXXTC_HAS_SSE42)
+        auto const bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        auto const limit = _mm_xor_si128(_mm_set1_epi32(static_cast<int>(threshold)), bias);
+        for (; i + 4 <= size; i += 4) {
+            auto const lanes = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i)), bias);
+            auto const mask = static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lanes, limit))));
+            if (mask != 0) { return i + static_cast<std::size_t>(std::countr_zero(mask)); }
+        }
+#endif
+        for (; i < size; ++i) {
+            if (values[i] > threshold) { return i; }
+        }
+        return size;
+    }
+
+    // Bit i of the result is set when values[i] is negative, for size <= 64
+    // samples; sign changes between neighbouring bits are zero crossings.
+    // Float signs come straight from movemask, and int16 samples are packed
+    // to bytes with signed saturation, which keeps their signs.
+    inline std::uint64_t negative_mask(float const* values, std::size_t size) noexcept {
+        std::uint64_t mask = 0;
+        std::size_t i = 0;
+#if defined(CXXTC_HAS_AVX2)
+        for (; i + 8 <= size; i += 8) {
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_loadu_ps(values + i)))) << i;
+        }
+#elif defined(CXXTC_HAS_SSE42)
+        for (; i + 4 <= size; i += 4) {
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_ps(_mm_loadu_ps(values + i)))) << i;
+        }
+#endif
+        for (; i < size; ++i) {
+            mask |= static_cast<std::uint64_t>(std::bit_cast<std::uint32_t>(values[i]) >> 31) << i;
+        }
+        return mask;
+    }
+
+    inline std::uint64_t negative_mask(std::int16_t const* values, std::size_t size) noexcept {
+        std::uint64_t mask = 0;
+        std::size_t i = 0;
+#if defined(CXXTC_HAS_AVX2)
+        for (; i + 32 <= size; i += 32) {
+            auto const low = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i));
+            auto const high = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i + 16));
+            auto const packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(low, high), 0xD8);
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(packed))) << i;
+        }
+#endif
+#if defined(CXXTC_HAS_SSE42)
+        for (; i + 16 <= size; i += 16) {
+            auto const low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i));
+            auto const high = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + i + 8));
+            mask |= static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(low, high)))) << i;
+        }
+#endif
+        for (; i < size; ++i) {
+            mask |= static_cast<std::uint64_t>(values[i] < 0) << i;
+        }
+        return mask;
+    }
+
+} // @END of namespace __cxxtc::__simd
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION File and Parallel Helpers --
+//
+// -----------------------------------------------------------------------------
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CXXTC_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace __cxxtc::__io {
+
+// Read-only view of a whole file. The file is memory-mapped where the
+// platform allows it, and read once into an owned buffer otherwise.
+struct MappedFile {
+    explicit MappedFile(char const* path) {
+#if CXXTC_HAS_MMAP
+        auto const fd = ::open(path, O_RDONLY);
+        if (fd < 0) {
+            CXXTC_THROW(std::format("could not open timecode file \"{}\"", path));
+        }
+
+        struct ::stat status{};
+        if (::fstat(fd, &status) != 0) {
+            ::close(fd);
+            CXXTC_THROW(std::format("could not stat timecode file \"{}\"", path));
+        }
+
+        _size = static_cast<std::size_t>(status.st_size);
+        if (_size > 0) {
+            auto* const mapped = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                CXXTC_THROW(std::format("could not map timecode file \"{}\"", path));
+            }
+            ::madvise(mapped, _size, MADV_SEQUENTIAL);
+            _data = static_cast<char const*>(mapped);
+        }
+        ::close(fd);
+#else
+        auto* const file = std::fopen(path, "rb");
+        if (file == nullptr) {
+            CXXTC_THROW(std::format("could not open timecode file \"{}\"", path));
+        }
+
+        char chunk[1 << 16];
+        std::size_t read = 0;
+        while ((read = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+            _buffer.append(chunk, read);
+        }
+        std::fclose(file);
+        _data = _buffer.data();
+        _size = _buffer.size();
+#endif
+    }
+
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+
+    ~MappedFile() {
+#if CXXTC_HAS_MMAP
+        if (_data != nullptr) {
+            ::munmap(const_cast<char*>(_data), _size);
+        }
+#endif
+    }
+
+    inline std::string_view view() const noexcept { return { _data, _size }; }
+
+private:
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+#if !CXXTC_HAS_MMAP
+    std::string _buffer;
+#endif
+};
+
+// Splits text into at most chunk_count pieces of roughly equal size, moving
+// each boundary forward to just past the next newline so that no line is
+// split across two chunks. Empty chunks are dropped.
+inline std::vector<std::string_view> split_lines(std::string_view text, std::size_t chunk_count) {
+    std::vector<std::string_view> chunks;
+    chunk_count = std::max<std::size_t>(chunk_count, 1);
+    chunks.reserve(chunk_count);
+
+    auto const target = text.size() / chunk_count + 1;
+    std::size_t begin = 0;
+    while (begin < text.size()) {
+        auto end = begin + target;
+        if (end >= text.size()) {
+            end = text.size();
+        } else {
+            auto const newline = text.find('\n', end - 1);
+            end = (newline == std::string_view::npos) ? text.size() : newline + 1;
+        }
+        chunks.push_back(text.substr(begin, end - begin));
+        begin = end;
+    }
+
+    return chunks;
+}
+
+} // @END of namespace __cxxtc::__io
+
+namespace __cxxtc::__parallel {
+
+// Runs task(i) for every i in [0, count) on up to thread_count threads. Each
+// worker owns a contiguous block of indices which it drains from the front;
+// a worker that runs dry steals from the back of the other workers' blocks.
+// Tasks never create new work, so a worker exits once every queue is empty.
+// The first exception thrown by a task is rethrown on the calling thread.
+template<typename Task>
+void for_each_stealing(std::size_t count, std::size_t thread_count, Task&& task) {
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    thread_count = std::min(thread_count, count);
+
+    if (thread_count <= 1) {
+        for (std::size_t i = 0; i < count; ++i) { task(i); }
+        return;
+    }
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::size_t> items;
+    };
+
+    std::vector<Queue> queues(thread_count);
+    for (std::size_t i = 0; i < count; ++i) {
+        queues[i * thread_count / count].items.push_back(i);
+    }
+
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    auto const next = [&](std::size_t worker) -> std::optional<std::size_t> {
+        {
+            std::scoped_lock lock{ queues[worker].mutex };
+            if (!queues[worker].items.empty()) {
+                auto const item = queues[worker].items.front();
+                queues[worker].items.pop_front();
+                return item;
+            }
+        }
+
+        for (std::size_t offset = 1; offset < thread_count; ++offset) {
+            auto& victim = queues[(worker + offset) % thread_count];
+            std::scoped_lock lock{ victim.mutex };
+            if (!victim.items.empty()) {
+                auto const item = victim.items.back();
+                victim.items.pop_back();
+                return item;
+            }
+        }
+
+        return std::nullopt;
+    };
+
+    auto const work = [&](std::size_t worker) {
+        while (auto const item = next(worker)) {
+            try {
+                task(*item);
+            } catch (...) {
+                std::scoped_lock lock{ error_mutex };
+                if (!error) { error = std::current_exception(); }
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(thread_count - 1);
+        for (std::size_t worker = 1; worker < thread_count; ++worker) {
+            threads.emplace_back(work, worker);
+        }
+        work(0);
+    }
+
+    if (error) { std::rethrow_exception(error); }
+}
+
+} // @END of namespace __cxxtc::__parallel
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION SMPTE 12M Helpers --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// SMPTE 12M linear timecode word: 80 bits in transmission order, bit i in
+// bit (i % 8) of byte i / 8. Bytes 0-7 interleave the time address (low
+// nibbles) with the user bits (high nibbles); bytes 8-9 hold the sync word.
+using LtcWord = std::array<std::uint8_t, 10>;
+
+} // @END OF namespace __cxxtc
+
+namespace __cxxtc::__smpte {
+
+    // The packed BCD time address used in SDI ancillary timecode and MXF,
+    // 0xHHMMSSFF, with the SMPTE 12M flags in the spare high bits of each
+    // byte. It is the low nibbles of LTC bytes 0-7, in the same order.
+    inline constexpr std::uint32_t BCD_DROP_FRAME_BIT = std::uint32_t{ 1 } << 6;
+    inline constexpr std::uint32_t BCD_FRAMES_MASK = 0x3F;
+    inline constexpr std::uint32_t BCD_SECONDS_MASK = 0x7F;
+    inline constexpr std::uint32_t BCD_MINUTES_MASK = 0x7F;
+    inline constexpr std::uint32_t BCD_HOURS_MASK = 0x3F;
+
+    // Bits 64-79: 0011 1111 1111 1101 in transmission order.
+    inline constexpr std::uint8_t LTC_SYNC_LOW = 0xFC;
+    inline constexpr std::uint8_t LTC_SYNC_HIGH = 0xBF;
+
+    // Biphase mark polarity correction bit, which keeps the number of zeros
+    // in the word even; 25 fps moves it from bit 27 to bit 59.
+    inline constexpr std::size_t LTC_POLARITY_BIT = 27;
+    inline constexpr std::size_t LTC_POLARITY_BIT_25 = 59;
+
+    // Binary value of every byte holding two BCD digits, or INVALID_BCD
+    // when either nibble is above 9.
+    inline constexpr std::uint8_t INVALID_BCD = 0xFF;
+    inline constexpr auto BCD_TO_BINARY = []() {
+        std::array<std::uint8_t, 256> table{};
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table[i] = ((i >> 4) <= 9 && (i & 0xF) <= 9) ? static_cast<std::uint8_t>((i >> 4) * 10 + (i & 0xF)) : INVALID_BCD;
+        }
+        return table;
+    }();
+
+    inline constexpr auto BINARY_TO_BCD = []() {
+        std::array<std::uint8_t, 100> table{};
+        for (std::size_t i = 0; i < table.size(); ++i) {
+            table[i] = static_cast<std::uint8_t>(((i / 10) << 4) | (i % 10));
+        }
+        return table;
+    }();
+
+    inline constexpr std::uint32_t encode_bcd(std::size_t hours, std::size_t minutes, std::size_t seconds, std::size_t frames, bool drop_frame) noexcept {
+        return (std::uint32_t{ BINARY_TO_BCD[hours] } << 24)
+             | (std::uint32_t{ BINARY_TO_BCD[minutes] } << 16)
+             | (std::uint32_t{ BINARY_TO_BCD[seconds] } << 8)
+             | std::uint32_t{ BINARY_TO_BCD[frames] }
+             | (drop_frame ? BCD_DROP_FRAME_BIT : 0);
+    }
+
+    // Interleaves the BCD time address and user bits into LTC bytes 0-7 and
+    // appends the sync word.
+    inline constexpr LtcWord bcd_to_ltc(std::uint32_t bcd, std::uint32_t user_bits) noexcept {
+        LtcWord word{};
+        for (std::size_t i = 0; i < 8; ++i) {
+            word[i] = static_cast<std::uint8_t>(((bcd >> (4 * i)) & 0xF) | (((user_bits >> (4 * i)) & 0xF) << 4));
+        }
+        word[8] = LTC_SYNC_LOW;
+        word[9] = LTC_SYNC_HIGH;
+        return word;
+    }
+
+    inline constexpr std::uint32_t ltc_to_bcd(LtcWord const& word) noexcept {
+        std::uint32_t bcd = 0;
+        for (std::size_t i = 0; i < 8; ++i) { bcd |= std::uint32_t{ word[i] & 0xFu } << (4 * i); }
+        return bcd;
+    }
+
+    inline constexpr std::uint32_t ltc_user_bits(LtcWord const& word) noexcept {
+        std::uint32_t user_bits = 0;
+        for (std::size_t i = 0; i < 8; ++i) { user_bits |= static_cast<std::uint32_t>(word[i] >> 4) << (4 * i); }
+        return user_bits;
+    }
+
+    inline constexpr bool ltc_sync_valid(LtcWord const& word) noexcept {
+        return word[8] == LTC_SYNC_LOW && word[9] == LTC_SYNC_HIGH;
+    }
+
+    inline constexpr void set_ltc_polarity(LtcWord& word, std::size_t bit) noexcept {
+        word[bit / 8] &= static_cast<std::uint8_t>(~(1u << (bit % 8)));
+        auto ones = 0;
+        for (auto const byte : word) { ones += std::popcount(byte); }
+        word[bit / 8] |= static_cast<std::uint8_t>((ones & 1) << (bit % 8));
+    }
+
+} // @END of namespace __cxxtc::__smpte
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION BasicTimecode Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+#define CXXTC_TICK_RATE_DEFAULT 1000
+#define CXXTC_TICKS_DEFAULT 0
+#define CXXTC_FLAG_DEFAULT 0b00000000
+#define CXXTC_FLAG_DROPFRAME 0b00000001
+#define CXXTC_REGULAR_FORM_SIZE 11
+#define CXXTC_EXTENDED_FORM_SIZE 15
+#define CXXTC_HRS_BEGIN_INDEX 0
+#define CXXTC_MINS_BEGIN_INDEX 3
+#define CXXTC_SECS_BEGIN_INDEX 6
+#define CXXTC_FRAMES_BEGIN_INDEX 9
+#define CXXTC_TICKS_BEGIN_INDEX 12
+#define CXXTC_HRS_MAX 24
+#define CXXTC_MINS_MAX 59
+#define CXXTC_SECS_MAX 59
+#define CXXTC_1HR_TICKS(fps, ticks) (60 * 60 * (fps) * (ticks))
+#define CXXTC_1MIN_TICKS(fps, ticks) (60 * (fps) * (ticks))
+#define CXXTC_1SEC_TICKS(fps, ticks) ((fps) * (ticks))
+#define CXXTC_1FRAME_TICKS(ticks) ((ticks))
+
+// TODO: static interface assertion with concept
+// TickRate is the number of ticks per frame. Presets are in TickRates; any
+// multiple of 4 or power of two works, and power-of-two rates split frames
+// and ticks with a shift and a mask.
+template<std::unsigned_integral IntType, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct BasicTimecode {
+    using fps_enum_type = __cxxtc::Fps;
+    using fps_variant_type = __cxxtc::Fps::Variant;
+    using fps_type = fps_enum_type;
+    using ticks_type = IntType;
+    using flags_type = std::uint8_t;
+    using string_type = std::string;
+    using string_view_type = std::string_view;
+    using offset_type = std::int64_t;
+
+    template<typename T, std::size_t N>
+    using span_type = std::span<T, N>;
+
+    template<std::integral T, std::size_t N>
+    using array_type = std::array<T, N>;
+
+    template<std::integral T>
+    using dynamic_array_type = std::vector<T>;
+
+    static constexpr ticks_type TICK_RATE = ticks_type{TickRate};
+    static_assert(
+        TickRate % 4 == 0 || std::has_single_bit(TickRate),
+        "tick rate must be a multiple of 4 or a power of two for the 32-bit reciprocal chain to stay exact"
+    );
+    static_assert(
+        std::numeric_limits<ticks_type>::max() / (CXXTC_HRS_MAX * 60 * 60 * 30) >= TickRate,
+        "ticks type cannot hold 24 hours at this tick rate"
+    );
+
+    static constexpr std::size_t STRING_SIZE_REGULAR = CXXTC_REGULAR_FORM_SIZE;
+    static constexpr std::size_t STRING_SIZE_EXTENDED = CXXTC_EXTENDED_FORM_SIZE;
+    static constexpr auto NOMINAL_TICKS_MAX = [](fps_type fps) constexpr { return CXXTC_HRS_MAX * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE); };
+    static constexpr auto TICKS_MAX = [](fps_type fps) constexpr {
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        return NOMINAL_TICKS_MAX(fps) - __arith::drop_frame_offset<ticks_type>(CXXTC_HRS_MAX * 60, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+    };
+
+    // Result of parts(), usable with structured bindings:
+    // auto const [hrs, mins, secs, frames, ticks] = tc.parts();
+    struct Parts {
+        ticks_type hours;
+        ticks_type minutes;
+        ticks_type seconds;
+        ticks_type frames;
+        ticks_type ticks;
+
+        constexpr bool operator==(Parts const&) const noexcept = default;
+    };
+
+public:
+    constexpr BasicTimecode() = delete;
+
+    constexpr BasicTimecode(fps_type fps) noexcept
+        : _fps(fps)
+        , _ticks(CXXTC_TICKS_DEFAULT)
+        , _flags((fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT)
+    {}
+
+    constexpr BasicTimecode(string_view_type tc, fps_type fps)
+        : _fps(fps)
+        , _ticks(CXXTC_TICKS_DEFAULT)
+        , _flags((fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT)
+    {
+        auto const ticks_result = BasicTimecode::parse_ticks(tc, fps);
+        if (!ticks_result.has_value()) { BasicTimecode::throw_parse_error(tc, fps, ticks_result.error()); }
+        _ticks = ticks_result.value();
+    }
+
+private:
+    explicit constexpr BasicTimecode(fps_type fps, ticks_type ticks, flags_type flags) noexcept
+        : _fps(fps)
+        , _ticks(ticks)
+        , _flags(flags)
+    {}
+
+public:
+    // Conversions between ticks into a frame and the thousandths of a frame
+    // in the ".TTT" field of the extended form, which are the same at the
+    // default tick rate. Other rates round up into ticks and down out of
+    // them, so a field survives a round trip whenever the rate is at least
+    // 1000; coarser rates stop at the last tick of the frame.
+    static constexpr ticks_type subframe_to_ticks(ticks_type thousandths) noexcept {
+        if constexpr (TICK_RATE == __text::SUBFRAME_RATE) { return thousandths; }
+        else {
+            auto const ticks = (std::uint64_t{ thousandths } * TICK_RATE + __text::SUBFRAME_RATE - 1) / __text::SUBFRAME_RATE;
+            return static_cast<ticks_type>(std::min<std::uint64_t>(ticks, TICK_RATE - 1));
+        }
+    }
+
+    static constexpr ticks_type ticks_to_subframe(ticks_type ticks) noexcept {
+        if constexpr (TICK_RATE == __text::SUBFRAME_RATE) { return ticks; }
+        else { return static_cast<ticks_type>(std::uint64_t{ ticks } * __text::SUBFRAME_RATE / TICK_RATE); }
+    }
+
+    // Exception-free parse of tc at fps into ticks, reporting why it fails:
+    // the core of every checked string path. Errors are plain enumerators,
+    // so the success path builds nothing extra.
+    static constexpr std::expected<ticks_type, ParseError> parse_ticks(string_view_type tc, fps_type fps) noexcept {
+        auto const tc_size = tc.size();
+        if (tc_size != CXXTC_REGULAR_FORM_SIZE && tc_size != CXXTC_EXTENDED_FORM_SIZE) {
+            return std::unexpected{ ParseError::BAD_LENGTH };
+        }
+
+        auto const fps_unsigned = fps_enum_type::to_unsigned_or_zero<ticks_type>(fps);
+        if (fps_unsigned == 0) { return std::unexpected{ ParseError::UNKNOWN_RATE }; }
+
+        ticks_type ticks = 0;
+        ticks_type hours = 0;
+        ticks_type minutes = 0;
+        ticks_type seconds = 0;
+        ticks_type frames = 0;
+
+        for (std::size_t i = 0; i < tc_size; i += 3) {
+            auto const first_char = tc[i + 0];
+            auto const second_char = tc[i + 1];
+
+            // NOTE: In the regular form, size of tc_string is NOT a multiple
+            // of 3, and we do not assume that the user has provided us with a
+            // valid null-terminated string, therefore, we explicitly terminate
+            // with a null-byte.
+            auto const third_char = (tc_size == CXXTC_EXTENDED_FORM_SIZE || i < CXXTC_FRAMES_BEGIN_INDEX)
+                ? tc[i + 2]
+                : '\0';
+
+            if (!('0' <= first_char && first_char <= '9') || !('0' <= second_char && second_char <= '9')) {
+                return std::unexpected{ ParseError::NOT_A_DIGIT };
+            }
+
+            auto const last_is_not_number = !('0' <= third_char && third_char <= '9');
+            auto const last_is_not_delimiter = (i == CXXTC_SECS_BEGIN_INDEX)
+                ? (third_char != ':' && third_char != ';')
+                : (i == CXXTC_FRAMES_BEGIN_INDEX)
+                    ? (tc_size == CXXTC_EXTENDED_FORM_SIZE)
+                        ? (third_char != '.')
+                        : (third_char != '\0')
+                    : third_char != ':';
+
+            if (i == CXXTC_TICKS_BEGIN_INDEX && last_is_not_number) { return std::unexpected{ ParseError::NOT_A_DIGIT }; }
+            if (i != CXXTC_TICKS_BEGIN_INDEX && last_is_not_delimiter) { return std::unexpected{ ParseError::BAD_DELIMITER }; }
+
+            auto const hundreds = (first_char - '0') * 100u;
+            auto const tens = (i == CXXTC_TICKS_BEGIN_INDEX) ? (second_char - '0') * 10u : (first_char - '0') * 10u;
+            auto const units = (i == CXXTC_TICKS_BEGIN_INDEX) ? (third_char - '0') * 1u : (second_char - '0') * 1u;
+            auto const value = (i == CXXTC_TICKS_BEGIN_INDEX) ? hundreds + tens + units : tens + units;
+
+            switch (i) {
+                case CXXTC_HRS_BEGIN_INDEX: {
+                    if (value > CXXTC_HRS_MAX) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+                    hours = value;
+                    ticks += value * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_MINS_BEGIN_INDEX: {
+                    if (value > CXXTC_MINS_MAX) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+                    minutes = value;
+                    ticks += value * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_SECS_BEGIN_INDEX: {
+                    if (value > CXXTC_SECS_MAX) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+                    seconds = value;
+                    ticks += value * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_FRAMES_BEGIN_INDEX: {
+                    if (value >= fps_unsigned) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+                    frames = value;
+                    ticks += value * CXXTC_1FRAME_TICKS(TICK_RATE);
+                } break;
+
+                case CXXTC_TICKS_BEGIN_INDEX: {
+                    if (value >= __text::SUBFRAME_RATE) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+                    ticks += BasicTimecode::subframe_to_ticks(value);
+                } break;
+
+                // unreachable
+                default: return std::unexpected{ ParseError::BAD_LENGTH };
+            }
+        }
+
+        // NOTE: Drop-frame labels are parsed at the nominal rate, then pulled
+        // back by the frame numbers skipped up to that label.
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        if (!__arith::drop_frame_label_valid(minutes, seconds, frames, dropped)) { return std::unexpected{ ParseError::DROPPED_FRAME }; }
+        return ticks - __arith::drop_frame_offset(hours * 60 + minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    // As from_string(), reporting why tc fails to parse. A timecode past the
+    // end of the day is OUT_OF_RANGE.
+    static constexpr std::expected<BasicTimecode, ParseError> parse(string_view_type tc, fps_type fps) noexcept {
+        auto const ticks = BasicTimecode::parse_ticks(tc, fps);
+        if (!ticks.has_value()) { return std::unexpected{ ticks.error() }; }
+        if (ticks.value() > TICKS_MAX(fps)) { return std::unexpected{ ParseError::OUT_OF_RANGE }; }
+        return BasicTimecode::from_ticks_unchecked(ticks.value(), fps);
+    }
+
+    static constexpr std::optional<ticks_type> timecode_to_ticks(string_view_type tc, fps_type fps) noexcept {
+        auto const ticks = BasicTimecode::parse_ticks(tc, fps);
+        if (!ticks.has_value()) { return std::nullopt; }
+        return ticks.value();
+    }
+
+    static constexpr ticks_type timecode_to_ticks_unchecked(string_view_type tc, fps_type fps) {
+        auto const tc_size = tc.size();
+        ticks_type ticks = 0;
+        ticks_type total_minutes = 0;
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+
+        for (std::size_t i = 0; i < tc_size; i += 3) {
+            auto const first_char = tc[i + 0];
+            auto const second_char = tc[i + 1];
+
+            auto const third_char = (tc_size == CXXTC_EXTENDED_FORM_SIZE || i < CXXTC_FRAMES_BEGIN_INDEX)
+                ? tc[i + 2]
+                : '\0';
+
+            auto const hundreds = (first_char - '0') * 100u;
+            auto const tens = (i == CXXTC_TICKS_BEGIN_INDEX) ? (second_char - '0') * 10u : (first_char - '0') * 10u;
+            auto const units = (i == CXXTC_TICKS_BEGIN_INDEX) ? (third_char - '0') * 1u : (second_char - '0') * 1u;
+            auto const value = (i == CXXTC_TICKS_BEGIN_INDEX) ? hundreds + tens + units : tens + units;
+
+            switch (i) {
+                case CXXTC_HRS_BEGIN_INDEX: {
+                    total_minutes += value * 60;
+                    ticks += value * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_MINS_BEGIN_INDEX: {
+                    total_minutes += value;
+                    ticks += value * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_SECS_BEGIN_INDEX: {
+                    ticks += value * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
+                } break;
+
+                case CXXTC_FRAMES_BEGIN_INDEX: {
+                    ticks += value * CXXTC_1FRAME_TICKS(TICK_RATE);
+                } break;
+
+                case CXXTC_TICKS_BEGIN_INDEX: {
+                    ticks += BasicTimecode::subframe_to_ticks(value);
+                } break;
+
+                default: CXXTC_THROW(std::format("could not parse timecode string \"{}\"", tc));
+            }
+        }
+
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        return ticks - __arith::drop_frame_offset(total_minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    // Batch form of timecode_to_ticks(). Each string in tcs is validated with
+    // exactly the same rules as the checked path, and its ticks are written to
+    // the same index in out. Strings that fail validation write 0 to out and
+    // have their index appended to failed, so a bad line does not abort the
+    // rest of the batch. Returns the number of strings parsed successfully.
+    static std::size_t timecodes_to_ticks(
+        span_type<string_view_type const, std::dynamic_extent> tcs,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed
+    ) {
+        CXXTC_ASSERT(out.size() >= tcs.size());
+        std::size_t parsed = 0;
+
+#if defined(CXXTC_HAS_SSE42)
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+
+        // NOTE: The views in tcs may end right before an unmapped page, so each
+        // record is staged into a zeroed 16-byte buffer before being loaded.
+        auto const stage = [](string_view_type tc) {
+            alignas(16) std::array<char, 16> staging = {};
+            auto const size = (tc.size() == CXXTC_REGULAR_FORM_SIZE || tc.size() == CXXTC_EXTENDED_FORM_SIZE) ? tc.size() : 0uz;
+            std::memcpy(staging.data(), tc.data(), size);
+            return _mm_load_si128(reinterpret_cast<__m128i const*>(staging.data()));
+        };
+
+        auto const is_form = [](string_view_type tc, std::size_t form) {
+            return tc.size() == form;
+        };
+
+        std::size_t i = 0;
+#if defined(CXXTC_HAS_AVX2)
+        for (; i + 1 < tcs.size(); i += 2) {
+            auto const extended = is_form(tcs[i], CXXTC_EXTENDED_FORM_SIZE);
+            if (extended != is_form(tcs[i + 1], CXXTC_EXTENDED_FORM_SIZE)) { break; }
+
+            __simd::ParsedFields a, b;
+            __simd::parse_fields_x2_avx2(stage(tcs[i]), stage(tcs[i + 1]), extended, fps_unsigned, a, b);
+            a.valid = a.valid && (extended || is_form(tcs[i], CXXTC_REGULAR_FORM_SIZE));
+            b.valid = b.valid && (extended || is_form(tcs[i + 1], CXXTC_REGULAR_FORM_SIZE));
+            parsed += BasicTimecode::store_parsed_fields(a, fps_unsigned, dropped, i, out, failed);
+            parsed += BasicTimecode::store_parsed_fields(b, fps_unsigned, dropped, i + 1, out, failed);
+        }
+#endif
+        for (; i < tcs.size(); ++i) {
+            auto const extended = is_form(tcs[i], CXXTC_EXTENDED_FORM_SIZE);
+            auto fields = __simd::parse_fields_sse42(stage(tcs[i]), extended, fps_unsigned);
+            fields.valid = fields.valid && (extended || is_form(tcs[i], CXXTC_REGULAR_FORM_SIZE));
+            parsed += BasicTimecode::store_parsed_fields(fields, fps_unsigned, dropped, i, out, failed);
+        }
+#else
+        for (std::size_t i = 0; i < tcs.size(); ++i) {
+            auto const ticks = BasicTimecode::timecode_to_ticks(tcs[i], fps);
+            out[i] = ticks.value_or(0);
+            if (ticks.has_value()) { parsed += 1; } else { failed.push_back(i); }
+        }
+#endif
+
+        return parsed;
+    }
+
+    // Batch form of timecode_to_ticks() over one packed buffer, where record i
+    // is the width bytes starting at packed[i * stride]. width must be the
+    // size of either the regular or extended form, and out.size() records are
+    // read. Records that run past the end of packed are reported as failed.
+    static std::size_t timecodes_to_ticks(
+        string_view_type packed,
+        std::size_t width,
+        std::size_t stride,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed
+    ) {
+        auto const in_bounds = [&packed, width, stride](std::size_t i) {
+            return i * stride + width <= packed.size();
+        };
+        std::size_t parsed = 0;
+
+#if defined(CXXTC_HAS_SSE42)
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        auto const extended = width == CXXTC_EXTENDED_FORM_SIZE;
+        auto const valid_width = width == CXXTC_REGULAR_FORM_SIZE || extended;
+
+        // NOTE: Records are loaded in place whenever a full 16 bytes can be
+        // read from packed; only the tail is staged through a local buffer.
+        auto const load = [&packed, width, stride, &in_bounds](std::size_t i) {
+            auto const offset = i * stride;
+            if (offset + 16 <= packed.size()) {
+                return _mm_loadu_si128(reinterpret_cast<__m128i const*>(packed.data() + offset));
+            }
+            alignas(16) std::array<char, 16> staging = {};
+            if (in_bounds(i)) { std::memcpy(staging.data(), packed.data() + offset, width); }
+            return _mm_load_si128(reinterpret_cast<__m128i const*>(staging.data()));
+        };
+
+        std::size_t i = 0;
+#if defined(CXXTC_HAS_AVX2)
+        for (; i + 1 < out.size(); i += 2) {
+            __simd::ParsedFields a, b;
+            __simd::parse_fields_x2_avx2(load(i), load(i + 1), extended, fps_unsigned, a, b);
+            a.valid = a.valid && valid_width && in_bounds(i);
+            b.valid = b.valid && valid_width && in_bounds(i + 1);
+            parsed += BasicTimecode::store_parsed_fields(a, fps_unsigned, dropped, i, out, failed);
+            parsed += BasicTimecode::store_parsed_fields(b, fps_unsigned, dropped, i + 1, out, failed);
+        }
+#endif
+        for (; i < out.size(); ++i) {
+            auto fields = __simd::parse_fields_sse42(load(i), extended, fps_unsigned);
+            fields.valid = fields.valid && valid_width && in_bounds(i);
+            parsed += BasicTimecode::store_parsed_fields(fields, fps_unsigned, dropped, i, out, failed);
+        }
+#else
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            auto const ticks = in_bounds(i)
+                ? BasicTimecode::timecode_to_ticks(packed.substr(i * stride, width), fps)
+                : std::nullopt;
+            out[i] = ticks.value_or(0);
+            if (ticks.has_value()) { parsed += 1; } else { failed.push_back(i); }
+        }
+#endif
+
+        return parsed;
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_ticks(T ticks, fps_type fps) noexcept {
+        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
+        flags_type flags = (fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
+        return BasicTimecode{ fps, ticks, flags };
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_ticks_unchecked(T ticks, fps_type fps) {
+        flags_type flags = (fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
+        return BasicTimecode{ fps, ticks, flags };
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_frames(T frames, fps_type fps) noexcept {
+        ticks_type const ticks = frames * CXXTC_1FRAME_TICKS(TICK_RATE);
+        return BasicTimecode::from_ticks(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_frames_unchecked(T frames, fps_type fps) {
+        ticks_type const ticks = frames * CXXTC_1FRAME_TICKS(TICK_RATE);
+        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_seconds(T seconds, fps_type fps) noexcept {
+        ticks_type const ticks = seconds * CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
+        return BasicTimecode::from_ticks(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_seconds_unchecked(T seconds, fps_type fps) {
+        ticks_type const ticks = seconds * CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
+        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_minutes(T minutes, fps_type fps) noexcept {
         ticks_type const ticks = minutes * CXXTC_1MIN_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
         return BasicTimecode::from_ticks(ticks, fps);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_minutes_unchecked(T minutes, fps_type fps) {
-        ticks_type const ticks = minutes * CXXTC_1MIN_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_minutes_unchecked(T minutes, fps_type fps) {
+        ticks_type const ticks = minutes * CXXTC_1MIN_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
+        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_hours(T hours, fps_type fps) noexcept {
+        ticks_type const ticks = hours * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
+        return BasicTimecode::from_ticks(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_hours_unchecked(T hours, fps_type fps) {
+        ticks_type const ticks = hours * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE); 
+        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<BasicTimecode> from_hmsf(T hours, T minutes, T seconds, T frames, fps_type fps) noexcept {
+        ticks_type ticks = 0;
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        ticks += hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
+        if (ticks > NOMINAL_TICKS_MAX(fps)) { return std::nullopt; }
+        ticks += minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
+        if (ticks > NOMINAL_TICKS_MAX(fps)) { return std::nullopt; }
+        ticks += seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
+        if (ticks > NOMINAL_TICKS_MAX(fps)) { return std::nullopt; }
+        ticks += frames * CXXTC_1FRAME_TICKS(TICK_RATE); 
+
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        if (!__arith::drop_frame_label_valid<ticks_type>(minutes, seconds, frames, dropped)) { return std::nullopt; }
+        ticks -= __arith::drop_frame_offset<ticks_type>(hours * 60 + minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+        return BasicTimecode::from_ticks(ticks, fps);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr BasicTimecode from_hmsf_unchecked(T hours, T minutes, T seconds, T frames, fps_type fps) {
+        ticks_type ticks = 0;
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        ticks += (hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE)); 
+        ticks += (minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE)); 
+        ticks += (seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE)); 
+        ticks += (frames * CXXTC_1FRAME_TICKS(TICK_RATE)); 
+
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        ticks -= __arith::drop_frame_offset<ticks_type>(hours * 60 + minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    }
+
+    static constexpr std::optional<BasicTimecode> from_string(string_view_type tc, fps_type fps) noexcept {
+        auto const ticks = BasicTimecode::timecode_to_ticks(tc, fps);
+        if (!ticks.has_value()) { return std::nullopt; }
+        return BasicTimecode::from_ticks_unchecked(ticks.value(), fps);
+    }
+
+    static constexpr BasicTimecode from_string_unchecked(string_view_type tc, fps_type fps) {
+        return BasicTimecode::from_ticks_unchecked(BasicTimecode::timecode_to_ticks_unchecked(tc, fps), fps);
+    }
+
+    // Hours, minutes, seconds, frames and optionally ticks, with the same
+    // range and drop-frame label checks as from_hmsf().
+    template<std::unsigned_integral T, std::size_t N>
+        requires (N == 4 || N == 5)
+    static constexpr std::optional<BasicTimecode> from_parts(array_type<T, N> parts, fps_type fps) noexcept {
+        auto const tc = BasicTimecode::from_hmsf(parts[0], parts[1], parts[2], parts[3], fps);
+        if constexpr (N == 4) {
+            return tc;
+        } else {
+            if (!tc.has_value()) { return std::nullopt; }
+            return BasicTimecode::from_ticks(tc->ticks() + parts[4], fps);
+        }
+    }
+
+    template<std::unsigned_integral T>
+    static std::optional<BasicTimecode> from_parts(dynamic_array_type<T> const& parts, fps_type fps) {
+        std::size_t size = parts.size();
+        if (size != 4 && size != 5) { return std::nullopt; }
+
+        auto const tc = BasicTimecode::from_hmsf(parts[0], parts[1], parts[2], parts[3], fps);
+        if (size == 4 || !tc.has_value()) { return tc; }
+        return BasicTimecode::from_ticks(tc->ticks() + parts[4], fps);
+    }
+
+    template<std::unsigned_integral T>
+    static BasicTimecode from_parts_unchecked(dynamic_array_type<T> const& parts, fps_type fps) {
+        std::size_t size = parts.size();
+        if (size != 4 && size != 5) {
+            CXXTC_THROW(std::format("timecode parts in dynamically allocated array with size {} could not be parsed", size));
+        }
+
+        auto const tc = BasicTimecode::from_hmsf_unchecked(parts[0], parts[1], parts[2], parts[3], fps);
+        if (size == 4) { return tc; }
+        return BasicTimecode::from_ticks_unchecked(tc.ticks() + parts[4], fps);
+    }
+
+    template<std::unsigned_integral U = std::uint32_t>
+        requires (std::numeric_limits<U>::max >= std::numeric_limits<ticks_type>::max)
+    inline constexpr U to_unsigned() const noexcept {
+        return _ticks;
+    }
+
+    template<std::signed_integral I = std::int32_t>
+        requires (std::numeric_limits<I>::max >= std::numeric_limits<ticks_type>::max)
+    inline constexpr I to_signed() const noexcept {
+        return _ticks;
+    }
+
+    template<std::floating_point F = float>
+    inline constexpr F to_float() const noexcept {
+        return _ticks;
+    }
+
+    // Adds delta ticks to ticks at fps, applying policy when the result
+    // falls outside [0, TICKS_MAX(fps)]. REPORT yields std::nullopt there.
+    static constexpr std::optional<ticks_type> offset_ticks(ticks_type ticks, offset_type delta, fps_type fps, OverflowPolicy policy = OverflowPolicy::REPORT) noexcept {
+        auto const day = static_cast<offset_type>(TICKS_MAX(fps));
+        auto const sum = static_cast<offset_type>(ticks) + delta;
+        switch (policy) {
+            case OverflowPolicy::WRAP: return static_cast<ticks_type>(((sum % day) + day) % day);
+            case OverflowPolicy::SATURATE: return static_cast<ticks_type>(std::clamp<offset_type>(sum, 0, day));
+            default: break;
+        }
+
+        if (sum < 0 || sum > day) { return std::nullopt; }
+        return static_cast<ticks_type>(sum);
+    }
+
+    // Batch form of offset_ticks(): adds delta to every value in ticks and
+    // writes the results to the same index of out, which may alias ticks.
+    // Under REPORT, values whose result overflows are copied unchanged. The
+    // indices of overflowing values are appended to overflowed under every
+    // policy, and their number is returned. The per-element loop is
+    // branch-free; values in ticks must themselves be within TICKS_MAX(fps).
+    static std::size_t offset_ticks(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        offset_type delta,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        OverflowPolicy policy,
+        dynamic_array_type<std::size_t>& overflowed
+    ) {
+        CXXTC_ASSERT(out.size() >= ticks.size());
+        switch (policy) {
+            case OverflowPolicy::WRAP: return BasicTimecode::offset_kernel<OverflowPolicy::WRAP>(ticks, delta, fps, out, overflowed);
+            case OverflowPolicy::SATURATE: return BasicTimecode::offset_kernel<OverflowPolicy::SATURATE>(ticks, delta, fps, out, overflowed);
+            case OverflowPolicy::REPORT: return BasicTimecode::offset_kernel<OverflowPolicy::REPORT>(ticks, delta, fps, out, overflowed);
+            default: CXXTC_THROW(std::format("unknown overflow policy with value: {}", policy.as_underlying()));
+        }
+    }
+
+    // Retimes ticks at rate from to the frame of rate to at the same real
+    // time, snapping between frames per snap. The exact rates are used, so
+    // 1000/1001 rates convert without drift; only integer math is involved.
+    // std::nullopt if the result is beyond TICKS_MAX(to).
+    static constexpr std::optional<ticks_type> convert_ticks(ticks_type ticks, fps_type from, fps_type to, SnapMode snap = SnapMode::NEAREST) noexcept {
+        auto const ratio = __arith::RateRatio::make(from, to, TICK_RATE, snap);
+        auto const result = ratio.apply(ticks);
+        if (result > TICKS_MAX(to)) { return std::nullopt; }
+        return static_cast<ticks_type>(result);
+    }
+
+    // Batch form of convert_ticks(), writing to the same index of out, which
+    // may alias ticks. Results beyond TICKS_MAX(to) are handled per policy
+    // as in offset_ticks(), and their indices appended to overflowed.
+    // Returns the number of results that overflowed.
+    static std::size_t convert_ticks(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type from,
+        fps_type to,
+        span_type<ticks_type, std::dynamic_extent> out,
+        SnapMode snap,
+        OverflowPolicy policy,
+        dynamic_array_type<std::size_t>& overflowed
+    ) {
+        CXXTC_ASSERT(out.size() >= ticks.size());
+        auto const ratio = __arith::RateRatio::make(from, to, TICK_RATE, snap);
+        switch (policy) {
+            case OverflowPolicy::WRAP: return BasicTimecode::convert_kernel<OverflowPolicy::WRAP>(ticks, ratio, to, out, overflowed);
+            case OverflowPolicy::SATURATE: return BasicTimecode::convert_kernel<OverflowPolicy::SATURATE>(ticks, ratio, to, out, overflowed);
+            case OverflowPolicy::REPORT: return BasicTimecode::convert_kernel<OverflowPolicy::REPORT>(ticks, ratio, to, out, overflowed);
+            default: CXXTC_THROW(std::format("unknown overflow policy with value: {}", policy.as_underlying()));
+        }
+    }
+
+    constexpr std::optional<BasicTimecode> convert(fps_type to, SnapMode snap = SnapMode::NEAREST) const noexcept {
+        auto const ticks = BasicTimecode::convert_ticks(_ticks, _fps, to, snap);
+        if (!ticks.has_value()) { return std::nullopt; }
+        return BasicTimecode::from_ticks_unchecked(ticks.value(), to);
+    }
+
+    // Index of the audio sample at sample_rate that this timecode falls on,
+    // counted from 00:00:00:00 at the exact frame rate (24000/1001 for
+    // 23.976), in integer arithmetic only.
+    constexpr std::uint64_t to_samples(std::uint64_t sample_rate, SnapMode snap = SnapMode::NEAREST) const {
+        return BasicTimecode::samples_scale(_fps, sample_rate, snap).apply(_ticks);
+    }
+
+    // Timecode at fps of sample index samples at sample_rate, or nullopt
+    // past the end of the day.
+    static constexpr std::optional<BasicTimecode> from_samples(std::uint64_t samples, std::uint64_t sample_rate, fps_type fps, SnapMode snap = SnapMode::NEAREST) noexcept {
+        auto const ticks = BasicTimecode::samples_scale(fps, sample_rate, snap, true).apply(samples);
+        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
+        return BasicTimecode::from_ticks(static_cast<ticks_type>(ticks), fps);
+    }
+
+    static constexpr BasicTimecode from_samples_unchecked(std::uint64_t samples, std::uint64_t sample_rate, fps_type fps, SnapMode snap = SnapMode::NEAREST) {
+        auto const tc = BasicTimecode::from_samples(samples, sample_rate, fps, snap);
+        if (!tc.has_value()) {
+            CXXTC_THROW(std::format("failed to construct timecode from sample {} at {} Hz with fps value \"{}\"", samples, sample_rate, fps.as_underlying()));
+        }
+        return tc.value();
+    }
+
+    // Real time since 00:00:00:00 at the exact frame rate, in any duration
+    // with an integral representation.
+    template<typename Duration = std::chrono::nanoseconds>
+        requires std::integral<typename Duration::rep>
+    constexpr Duration to_duration(SnapMode snap = SnapMode::NEAREST) const {
+        return Duration{ static_cast<typename Duration::rep>(BasicTimecode::duration_scale<typename Duration::period>(_fps, snap).apply(_ticks)) };
+    }
+
+    // Timecode at fps of the real time duration since 00:00:00:00, or
+    // nullopt if it is negative or past the end of the day.
+    template<typename Rep, typename Period>
+        requires std::integral<Rep>
+    static constexpr std::optional<BasicTimecode> from_duration(std::chrono::duration<Rep, Period> duration, fps_type fps, SnapMode snap = SnapMode::NEAREST) noexcept {
+        if (duration.count() < 0) { return std::nullopt; }
+        auto const ticks = BasicTimecode::duration_scale<Period>(fps, snap, true).apply(static_cast<std::uint64_t>(duration.count()));
+        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
+        return BasicTimecode::from_ticks(static_cast<ticks_type>(ticks), fps);
+    }
+
+    template<typename Rep, typename Period>
+        requires std::integral<Rep>
+    static constexpr BasicTimecode from_duration_unchecked(std::chrono::duration<Rep, Period> duration, fps_type fps, SnapMode snap = SnapMode::NEAREST) {
+        auto const tc = BasicTimecode::from_duration(duration, fps, snap);
+        if (!tc.has_value()) {
+            CXXTC_THROW(std::format("failed to construct timecode from duration of {} with fps value \"{}\"", duration.count(), fps.as_underlying()));
+        }
+        return tc.value();
+    }
+
+    // Batch form of to_samples(): writes the sample index of every value in
+    // ticks at fps to the same index in out.
+    static void ticks_to_samples(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type fps,
+        std::uint64_t sample_rate,
+        span_type<std::uint64_t, std::dynamic_extent> out,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        CXXTC_ASSERT(out.size() >= ticks.size());
+        auto const scale = BasicTimecode::samples_scale(fps, sample_rate, snap);
+        for (std::size_t i = 0; i < ticks.size(); ++i) { out[i] = scale.apply(ticks[i]); }
+    }
+
+    // Batch form of from_samples(). Sample indices past the end of the day
+    // write 0 to out and have their index appended to failed. Returns the
+    // number converted.
+    static std::size_t samples_to_ticks(
+        span_type<std::uint64_t const, std::dynamic_extent> samples,
+        std::uint64_t sample_rate,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        CXXTC_ASSERT(out.size() >= samples.size());
+        auto const scale = BasicTimecode::samples_scale(fps, sample_rate, snap, true);
+        return BasicTimecode::scale_to_ticks(samples, scale, fps, out, failed);
+    }
+
+    // Batch form of to_duration().
+    template<typename Duration>
+        requires std::integral<typename Duration::rep>
+    static void ticks_to_durations(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type fps,
+        span_type<Duration, std::dynamic_extent> out,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        CXXTC_ASSERT(out.size() >= ticks.size());
+        auto const scale = BasicTimecode::duration_scale<typename Duration::period>(fps, snap);
+        for (std::size_t i = 0; i < ticks.size(); ++i) { out[i] = Duration{ static_cast<typename Duration::rep>(scale.apply(ticks[i])) }; }
+    }
+
+    // Batch form of from_duration(). Negative durations and durations past
+    // the end of the day write 0 to out and have their index appended to
+    // failed. Returns the number converted.
+    template<typename Duration>
+        requires std::integral<typename Duration::rep>
+    static std::size_t durations_to_ticks(
+        span_type<Duration const, std::dynamic_extent> durations,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        CXXTC_ASSERT(out.size() >= durations.size());
+        auto const scale = BasicTimecode::duration_scale<typename Duration::period>(fps, snap, true);
+        auto const day = static_cast<std::uint64_t>(TICKS_MAX(fps));
+        std::size_t converted = 0;
+        for (std::size_t i = 0; i < durations.size(); ++i) {
+            auto const count = durations[i].count();
+            auto const ticks = (count < 0) ? day + 1 : scale.apply(static_cast<std::uint64_t>(count));
+            out[i] = (ticks <= day) ? static_cast<ticks_type>(ticks) : 0;
+            if (ticks <= day) { converted += 1; } else { failed.push_back(i); }
+        }
+        return converted;
+    }
+
+    constexpr std::optional<BasicTimecode> offset(offset_type delta, OverflowPolicy policy = OverflowPolicy::REPORT) const noexcept {
+        auto const ticks = BasicTimecode::offset_ticks(_ticks, delta, _fps, policy);
+        if (!ticks.has_value()) { return std::nullopt; }
+        return BasicTimecode{ _fps, ticks.value(), _flags };
+    }
+
+    // Sum and difference of two timecodes at the same rate; std::nullopt if
+    // the rates differ or, under REPORT, if the result overflows.
+    constexpr std::optional<BasicTimecode> add(BasicTimecode const& other, OverflowPolicy policy = OverflowPolicy::REPORT) const noexcept {
+        if (other._fps != _fps) { return std::nullopt; }
+        return offset(static_cast<offset_type>(other._ticks), policy);
+    }
+
+    constexpr std::optional<BasicTimecode> subtract(BasicTimecode const& other, OverflowPolicy policy = OverflowPolicy::REPORT) const noexcept {
+        if (other._fps != _fps) { return std::nullopt; }
+        return offset(-static_cast<offset_type>(other._ticks), policy);
+    }
+
+    // Throwing forms of add() and subtract() with the REPORT policy.
+    constexpr BasicTimecode operator+(BasicTimecode const& other) const {
+        auto const result = add(other);
+        if (!result.has_value()) {
+            CXXTC_THROW(std::format("failed to add timecodes with ticks {} and {} at fps values \"{}\" and \"{}\"", _ticks, other._ticks, _fps.as_underlying(), other._fps.as_underlying()));
+        }
+        return result.value();
+    }
+
+    constexpr BasicTimecode operator-(BasicTimecode const& other) const {
+        auto const result = subtract(other);
+        if (!result.has_value()) {
+            CXXTC_THROW(std::format("failed to subtract timecodes with ticks {} and {} at fps values \"{}\" and \"{}\"", _ticks, other._ticks, _fps.as_underlying(), other._fps.as_underlying()));
+        }
+        return result.value();
+    }
+
+    constexpr BasicTimecode& operator+=(BasicTimecode const& other) {
+        _ticks = (*this + other)._ticks;
+        return *this;
+    }
+
+    constexpr BasicTimecode& operator-=(BasicTimecode const& other) {
+        _ticks = (*this - other)._ticks;
+        return *this;
+    }
+
+    // Orders timecodes by the real time they stand for, exactly, including
+    // across frame rates; 00:00:01:00 at 25 and at 24 compare equal.
+    constexpr std::weak_ordering operator<=>(BasicTimecode const& other) const {
+        if (other._fps == _fps) { return _ticks <=> other._ticks; }
+        auto const scale = __arith::CrossScale::make(_fps, other._fps);
+        return __arith::CrossScale::key(_ticks, scale.lhs) <=> __arith::CrossScale::key(other._ticks, scale.rhs);
+    }
+
+    constexpr bool operator==(BasicTimecode const& other) const {
+        return (*this <=> other) == 0;
+    }
+
+    // Inner join of two ascending ticks columns at possibly different rates
+    // on equal real time, in a single linear pass with no conversion. Calls
+    // on_match(i, j) for every pair with lhs[i] equal to rhs[j], so runs of
+    // equal values on both sides yield every combination.
+    template<typename OnMatch>
+    static constexpr void merge_join(
+        span_type<ticks_type const, std::dynamic_extent> lhs,
+        fps_type lhs_fps,
+        span_type<ticks_type const, std::dynamic_extent> rhs,
+        fps_type rhs_fps,
+        OnMatch&& on_match
+    ) {
+        auto const scale = __arith::CrossScale::make(lhs_fps, rhs_fps);
+        auto const lhs_key = [&](std::size_t i) { return __arith::CrossScale::key(lhs[i], scale.lhs); };
+        auto const rhs_key = [&](std::size_t j) { return __arith::CrossScale::key(rhs[j], scale.rhs); };
+
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < lhs.size() && j < rhs.size()) {
+            auto const key = lhs_key(i);
+            auto const other = rhs_key(j);
+            if (key < other) { ++i; continue; }
+            if (other < key) { ++j; continue; }
+
+            auto lhs_end = i + 1;
+            while (lhs_end < lhs.size() && lhs_key(lhs_end) == key) { ++lhs_end; }
+            auto rhs_end = j + 1;
+            while (rhs_end < rhs.size() && rhs_key(rhs_end) == key) { ++rhs_end; }
+
+            for (auto l = i; l < lhs_end; ++l) {
+                for (auto r = j; r < rhs_end; ++r) { on_match(l, r); }
+            }
+            i = lhs_end;
+            j = rhs_end;
+        }
+    }
+
+    // Writes "HH:MM:SS:FF" or "HH:MM:SS:FF.TTT" to out without allocating,
+    // and returns one past the last character written. out must have room
+    // for STRING_SIZE_REGULAR or STRING_SIZE_EXTENDED characters respectively.
+    // Drop-frame timecodes use ';' to separate the seconds and frames.
+    constexpr char* format_to(char* out, TimecodeForm form = TimecodeForm::REGULAR) const {
+        auto const frames_delimiter = (_flags & CXXTC_FLAG_DROPFRAME) ? ';' : ':';
+        auto const [h, m, s, f, t] = parts();
+        return __text::write_timecode(out, h, m, s, f, BasicTimecode::ticks_to_subframe(t), form == TimecodeForm::EXTENDED, frames_delimiter);
+    }
+
+    template<std::output_iterator<char> OutputIt>
+    constexpr OutputIt format_to(OutputIt out, TimecodeForm form = TimecodeForm::REGULAR) const {
+        std::array<char, STRING_SIZE_EXTENDED> buffer;
+        auto const end = format_to(buffer.data(), form);
+        return std::copy(buffer.data(), end, out);
+    }
+
+    template<typename S = std::string>
+    constexpr S to_string(TimecodeForm form = TimecodeForm::REGULAR) const {
+        S result;
+        result.resize((form == TimecodeForm::EXTENDED) ? STRING_SIZE_EXTENDED : STRING_SIZE_REGULAR);
+        format_to(result.data(), form);
+        return result;
+    }
+
+    // Number of characters ticks_to_timecodes() writes for count timecodes.
+    static constexpr std::size_t formatted_size(std::size_t count, TimecodeForm form = TimecodeForm::REGULAR, bool newline = false) noexcept {
+        auto const width = (form == TimecodeForm::EXTENDED) ? STRING_SIZE_EXTENDED : STRING_SIZE_REGULAR;
+        return count * (width + (newline ? 1 : 0));
+    }
+
+    // Bulk form of format_to(): writes every value in ticks as fixed-width
+    // timecode text at fps into out, back to back or newline-separated, and
+    // returns the number of characters written. out must hold at least
+    // formatted_size(ticks.size(), form, newline) characters. The division
+    // chain runs on the per-rate reciprocals, vectorized when the target
+    // enables SSE4.2/AVX2.
+    static std::size_t ticks_to_timecodes(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type fps,
+        span_type<char, std::dynamic_extent> out,
+        TimecodeForm form = TimecodeForm::REGULAR,
+        bool newline = false
+    ) {
+        CXXTC_ASSERT(out.size() >= formatted_size(ticks.size(), form, newline));
+        auto const extended = form == TimecodeForm::EXTENDED;
+        auto const frames_delimiter = (fps_enum_type::drop_frame(fps)) ? ';' : ':';
+
+        auto const& reciprocals = BasicTimecode::decompose_reciprocals(fps);
+
+        auto cursor = out.data();
+        auto const write = [&](std::uint32_t h, std::uint32_t m, std::uint32_t s, std::uint32_t f, std::uint32_t t) {
+            cursor = __text::write_timecode(cursor, h, m, s, f, BasicTimecode::ticks_to_subframe(t), extended, frames_delimiter);
+            if (newline) { *cursor++ = '\n'; }
+        };
+
+        std::size_t i = 0;
+        if constexpr (SIMD_DECOMPOSE) {
+#if defined(CXXTC_HAS_AVX2)
+            __simd::DecomposedLanes<8> lanes;
+            for (; i + 8 <= ticks.size(); i += 8) {
+                __simd::decompose_x8_avx2(
+                    ticks.data() + i, reciprocals,
+                    lanes.hours.data(), lanes.minutes.data(), lanes.seconds.data(), lanes.frames.data(), lanes.ticks.data()
+                );
+                for (std::size_t lane = 0; lane < 8; ++lane) {
+                    write(lanes.hours[lane], lanes.minutes[lane], lanes.seconds[lane], lanes.frames[lane], lanes.ticks[lane]);
+                }
+            }
+#elif defined(CXXTC_HAS_SSE42)
+            __simd::DecomposedLanes<4> lanes;
+            for (; i + 4 <= ticks.size(); i += 4) {
+                __simd::decompose_x4_sse42(
+                    ticks.data() + i, reciprocals,
+                    lanes.hours.data(), lanes.minutes.data(), lanes.seconds.data(), lanes.frames.data(), lanes.ticks.data()
+                );
+                for (std::size_t lane = 0; lane < 4; ++lane) {
+                    write(lanes.hours[lane], lanes.minutes[lane], lanes.seconds[lane], lanes.frames[lane], lanes.ticks[lane]);
+                }
+            }
+#endif
+        }
+
+        for (; i < ticks.size(); ++i) {
+            auto const [h, m, s, f, t] = BasicTimecode::decompose(ticks[i], reciprocals);
+            write(h, m, s, f, t);
+        }
+
+        return static_cast<std::size_t>(cursor - out.data());
+    }
+
+    // All five parts of the timecode in one pass over the per-rate
+    // reciprocals, rather than one division chain per *_part() accessor.
+    constexpr Parts parts() const {
+        return BasicTimecode::decompose(_ticks, BasicTimecode::decompose_reciprocals(_fps));
+    }
+
+    // Batch form of parts(): decomposes every value in ticks at fps into
+    // the same index of each of the five output columns, which must be at
+    // least as long as ticks.
+    static void ticks_to_parts(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> hours,
+        span_type<ticks_type, std::dynamic_extent> minutes,
+        span_type<ticks_type, std::dynamic_extent> seconds,
+        span_type<ticks_type, std::dynamic_extent> frames,
+        span_type<ticks_type, std::dynamic_extent> ticks_parts
+    ) {
+        CXXTC_ASSERT(hours.size() >= ticks.size() && minutes.size() >= ticks.size() && seconds.size() >= ticks.size());
+        CXXTC_ASSERT(frames.size() >= ticks.size() && ticks_parts.size() >= ticks.size());
+        auto const& reciprocals = BasicTimecode::decompose_reciprocals(fps);
+
+        std::size_t i = 0;
+        if constexpr (SIMD_DECOMPOSE) {
+#if defined(CXXTC_HAS_AVX2)
+            for (; i + 8 <= ticks.size(); i += 8) {
+                __simd::decompose_x8_avx2(
+                    ticks.data() + i, reciprocals,
+                    hours.data() + i, minutes.data() + i, seconds.data() + i, frames.data() + i, ticks_parts.data() + i
+                );
+            }
+#elif defined(CXXTC_HAS_SSE42)
+            for (; i + 4 <= ticks.size(); i += 4) {
+                __simd::decompose_x4_sse42(
+                    ticks.data() + i, reciprocals,
+                    hours.data() + i, minutes.data() + i, seconds.data() + i, frames.data() + i, ticks_parts.data() + i
+                );
+            }
+#endif
+        }
+
+        for (; i < ticks.size(); ++i) {
+            auto const [h, m, s, f, t] = BasicTimecode::decompose(ticks[i], reciprocals);
+            hours[i] = h;
+            minutes[i] = m;
+            seconds[i] = s;
+            frames[i] = f;
+            ticks_parts[i] = t;
+        }
+    }
+
+    // SMPTE 12M packed BCD time address, 0xHHMMSSFF, with the drop-frame
+    // flag set from CXXTC_FLAG_DROPFRAME and every other flag clear.
+    constexpr std::uint32_t to_bcd() const {
+        auto const [h, m, s, f, t] = parts();
+        return __smpte::encode_bcd(h % CXXTC_HRS_MAX, m, s, f, (_flags & CXXTC_FLAG_DROPFRAME) != 0);
+    }
+
+    // Reads a packed BCD time address at fps. Fails on digits that are not
+    // BCD, fields out of range, dropped frame labels, or a drop-frame flag
+    // that disagrees with fps; the other flag bits are ignored.
+    static constexpr std::optional<BasicTimecode> from_bcd(std::uint32_t bcd, fps_type fps) noexcept {
+        auto const ticks = BasicTimecode::bcd_to_ticks(bcd, fps_enum_type::to_unsigned<ticks_type>(fps), fps_enum_type::dropped_frames<ticks_type>(fps), fps_enum_type::drop_frame(fps));
+        if (!ticks.has_value()) { return std::nullopt; }
+        return BasicTimecode::from_ticks(*ticks, fps);
+    }
+
+    static constexpr BasicTimecode from_bcd_unchecked(std::uint32_t bcd, fps_type fps) {
+        auto const tc = BasicTimecode::from_bcd(bcd, fps);
+        if (!tc.has_value()) {
+            CXXTC_THROW(std::format("failed to construct timecode from BCD word 0x{:08X} with fps value \"{}\"", bcd, fps.as_underlying()));
+        }
+        return tc.value();
+    }
+
+    // SMPTE 12M 80-bit LTC word for this timecode, carrying user_bits as
+    // eight 4-bit binary groups, low group first. The polarity correction
+    // bit is set for the frame rate; the other flags are clear.
+    constexpr LtcWord to_ltc(std::uint32_t user_bits = 0) const {
+        auto word = __smpte::bcd_to_ltc(to_bcd(), user_bits);
+        __smpte::set_ltc_polarity(word, (_fps == fps_enum_type::F_25) ? __smpte::LTC_POLARITY_BIT_25 : __smpte::LTC_POLARITY_BIT);
+        return word;
+    }
+
+    // Reads the time address of an LTC word at fps, as from_bcd(); fails if
+    // the sync word is missing.
+    static constexpr std::optional<BasicTimecode> from_ltc(LtcWord const& word, fps_type fps) noexcept {
+        if (!__smpte::ltc_sync_valid(word)) { return std::nullopt; }
+        return BasicTimecode::from_bcd(__smpte::ltc_to_bcd(word), fps);
+    }
+
+    static constexpr BasicTimecode from_ltc_unchecked(LtcWord const& word, fps_type fps) {
+        auto const tc = BasicTimecode::from_ltc(word, fps);
+        if (!tc.has_value()) {
+            CXXTC_THROW(std::format("failed to construct timecode from LTC word with fps value \"{}\"", fps.as_underlying()));
+        }
+        return tc.value();
+    }
+
+    static constexpr std::uint32_t ltc_user_bits(LtcWord const& word) noexcept {
+        return __smpte::ltc_user_bits(word);
+    }
+
+    // Batch form of from_bcd(): writes the ticks of every word in bcds to
+    // the same index in out, or 0 with the index appended to failed.
+    // Returns the number of words decoded.
+    static std::size_t bcds_to_ticks(
+        span_type<std::uint32_t const, std::dynamic_extent> bcds,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed
+    ) {
+        CXXTC_ASSERT(out.size() >= bcds.size());
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(fps);
+        auto const drop_frame = fps_enum_type::drop_frame(fps);
+        std::size_t decoded = 0;
+
+        for (std::size_t i = 0; i < bcds.size(); ++i) {
+            auto const ticks = BasicTimecode::bcd_to_ticks(bcds[i], fps_unsigned, dropped, drop_frame);
+            out[i] = ticks.value_or(0);
+            if (ticks.has_value()) { decoded += 1; } else { failed.push_back(i); }
+        }
+
+        return decoded;
+    }
+
+    // Batch form of to_bcd(): ticks are decomposed in blocks with the same
+    // kernels as ticks_to_parts(), then encoded through a digit table.
+    static void ticks_to_bcds(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        fps_type fps,
+        span_type<std::uint32_t, std::dynamic_extent> out
+    ) {
+        CXXTC_ASSERT(out.size() >= ticks.size());
+        constexpr std::size_t BLOCK_SIZE = 256;
+        std::array<std::array<ticks_type, BLOCK_SIZE>, 5> parts;
+        auto const drop_frame = fps_enum_type::drop_frame(fps);
+
+        for (std::size_t begin = 0; begin < ticks.size(); begin += BLOCK_SIZE) {
+            auto const size = std::min(BLOCK_SIZE, ticks.size() - begin);
+            BasicTimecode::ticks_to_parts(ticks.subspan(begin, size), fps, parts[0], parts[1], parts[2], parts[3], parts[4]);
+            for (std::size_t i = 0; i < size; ++i) {
+                out[begin + i] = __smpte::encode_bcd(parts[0][i] % CXXTC_HRS_MAX, parts[1][i], parts[2][i], parts[3][i], drop_frame);
+            }
+        }
+    }
+
+    constexpr ticks_type hours_part() const {
+        return label_ticks() / CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(_fps), TICK_RATE);
+    }
+
+    constexpr ticks_type minutes_part() const {
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(_fps);
+        auto const reduced = label_ticks() % CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
+        return reduced / CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
+    }
+
+    constexpr ticks_type seconds_part() const {
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(_fps);
+        auto const reduced = label_ticks() % CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
+        return reduced / CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
+    }
+
+    constexpr ticks_type frames_part() const {
+        auto const reduced = label_ticks() % CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(_fps), TICK_RATE);
+        return reduced / CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    constexpr ticks_type ticks_part() const {
+        auto const reduced = _ticks % CXXTC_1FRAME_TICKS(TICK_RATE);
+        return reduced;
+    }
+
+    // Ticks as counted by the timecode's label at the nominal rate, which
+    // only differs from ticks() for drop-frame rates.
+    constexpr ticks_type label_ticks() const {
+        auto const dropped = fps_enum_type::dropped_frames<ticks_type>(_fps);
+        if (dropped == 0) { return _ticks; }
+        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(_fps);
+        auto const frames = __arith::drop_frame_to_label(_ticks / CXXTC_1FRAME_TICKS(TICK_RATE), fps_unsigned, dropped);
+        return frames * CXXTC_1FRAME_TICKS(TICK_RATE) + _ticks % CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    inline constexpr fps_type fps() const {
+        return _fps;
+    }
+
+    inline constexpr ticks_type ticks() const {
+        return _ticks;
+    }
+
+    inline constexpr flags_type flags() const {
+        return _flags;
+    }
+
+private:
+    static constexpr __arith::DecomposeReciprocals RECIPROCALS_24 = __arith::DecomposeReciprocals::make(TICK_RATE, 24);
+    static constexpr __arith::DecomposeReciprocals RECIPROCALS_25 = __arith::DecomposeReciprocals::make(TICK_RATE, 25);
+    static constexpr __arith::DecomposeReciprocals RECIPROCALS_30 = __arith::DecomposeReciprocals::make(TICK_RATE, 30);
+    static constexpr __arith::DecomposeReciprocals RECIPROCALS_29P97_DF = __arith::DecomposeReciprocals::make(TICK_RATE, 30, 2);
+
+    // Largest ticks the reciprocal chain is exact for, and whether the
+    // vectorized kernels, which have no fallback, cover every ticks value.
+    static constexpr std::uint64_t RECIPROCAL_TICKS_MAX = std::min<std::uint64_t>(
+        std::numeric_limits<std::uint32_t>::max(),
+        (std::uint64_t{ 1 } << __arith::DecomposeReciprocals::RECIPROCAL_BITS_MAX) * TickRate - 1
+    );
+    static constexpr bool SIMD_DECOMPOSE = std::same_as<ticks_type, std::uint32_t> && RECIPROCAL_TICKS_MAX == std::numeric_limits<std::uint32_t>::max();
+
+    static constexpr __arith::DecomposeReciprocals const& decompose_reciprocals(fps_type fps) {
+        switch (fps) {
+            case fps_enum_type::F_23P976_DF:
+            case fps_enum_type::F_23P976_NDF:
+            case fps_enum_type::F_24: return RECIPROCALS_24;
+
+            case fps_enum_type::F_25: return RECIPROCALS_25;
+
+            case fps_enum_type::F_29P97_NDF:
+            case fps_enum_type::F_30: return RECIPROCALS_30;
+
+            case fps_enum_type::F_29P97_DF: return RECIPROCALS_29P97_DF;
+
+            default: CXXTC_THROW(std::format("unknown fps type with value: {}", fps.as_underlying()));
+        }
+    }
+
+    static constexpr Parts decompose(ticks_type ticks, __arith::DecomposeReciprocals const& reciprocals) noexcept {
+        // NOTE: Values the 32-bit reciprocals are not exact for, held by wider
+        // ticks types or far beyond a day at tick rates below 4, fall back
+        // to plain division.
+        if (ticks > RECIPROCAL_TICKS_MAX) {
+            ticks_type const tick_rate = reciprocals.tick_rate.divisor;
+            ticks_type const fps = reciprocals.fps.divisor;
+            ticks_type const dropped = reciprocals.dropped;
+            auto const total_frames = __arith::drop_frame_to_label(ticks / tick_rate, fps, dropped);
+            auto const total_seconds = total_frames / fps;
+            auto const total_minutes = total_seconds / 60;
+            return Parts{ total_minutes / 60, total_minutes % 60, total_seconds % 60, total_frames % fps, ticks % tick_rate };
+        }
+
+        if constexpr (std::has_single_bit(TickRate)) {
+            auto const value = static_cast<std::uint32_t>(ticks);
+            auto const [h, m, s, f, t] = reciprocals.decompose_frames(value >> std::countr_zero(TickRate), value & (TickRate - 1));
+            return Parts{ h, m, s, f, t };
+        } else {
+            auto const [h, m, s, f, t] = reciprocals.decompose(static_cast<std::uint32_t>(ticks));
+            return Parts{ h, m, s, f, t };
+        }
+    }
+
+    template<OverflowPolicy::Variant Policy>
+    static std::size_t offset_kernel(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        offset_type delta,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& overflowed
+    ) {
+        auto const day = static_cast<offset_type>(TICKS_MAX(fps));
+        auto const wrapped_delta = ((delta % day) + day) % day;
+
+        // NOTE: Overflowing indices are always written to the next free slot
+        // of a block-sized buffer and the slot only advances on overflow, so
+        // reporting them needs no branch in the loop.
+        static constexpr std::size_t BLOCK_SIZE = 256;
+        std::array<std::size_t, BLOCK_SIZE> hits;
+        std::size_t total = 0;
+
+        for (std::size_t begin = 0; begin < ticks.size(); begin += BLOCK_SIZE) {
+            auto const end = std::min(begin + BLOCK_SIZE, ticks.size());
+            std::size_t count = 0;
+            for (auto i = begin; i < end; ++i) {
+                auto const value = static_cast<offset_type>(ticks[i]);
+                auto const sum = value + delta;
+                auto const overflow = (sum < 0) | (sum > day);
+
+                offset_type result = 0;
+                if constexpr (Policy == OverflowPolicy::WRAP) {
+                    auto const wrapped = value + wrapped_delta;
+                    result = wrapped - day * (wrapped >= day);
+                } else if constexpr (Policy == OverflowPolicy::SATURATE) {
+                    result = std::min(std::max(sum, offset_type{ 0 }), day);
+                } else {
+                    result = overflow ? value : sum;
+                }
+
+                out[i] = static_cast<ticks_type>(result);
+                hits[count] = i;
+                count += overflow;
+            }
+            overflowed.insert(overflowed.end(), hits.begin(), hits.begin() + count);
+            total += count;
+        }
+
+        return total;
+    }
+
+    template<OverflowPolicy::Variant Policy>
+    static std::size_t convert_kernel(
+        span_type<ticks_type const, std::dynamic_extent> ticks,
+        __arith::RateRatio const& ratio,
+        fps_type to,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& overflowed
+    ) {
+        auto const day = static_cast<std::uint64_t>(TICKS_MAX(to));
+
+        // NOTE: The same block-wise index capture as offset_kernel(). Converted
+        // values stay below twice the range, so one subtraction wraps them.
+        static constexpr std::size_t BLOCK_SIZE = 256;
+        std::array<std::size_t, BLOCK_SIZE> hits;
+        std::size_t total = 0;
+
+        for (std::size_t begin = 0; begin < ticks.size(); begin += BLOCK_SIZE) {
+            auto const end = std::min(begin + BLOCK_SIZE, ticks.size());
+            std::size_t count = 0;
+            for (auto i = begin; i < end; ++i) {
+                auto const converted = ratio.apply(ticks[i]);
+                auto const overflow = converted > day;
+
+                std::uint64_t result = 0;
+                if constexpr (Policy == OverflowPolicy::WRAP) {
+                    result = converted - day * (converted >= day);
+                } else if constexpr (Policy == OverflowPolicy::SATURATE) {
+                    result = std::min(converted, day);
+                } else {
+                    result = overflow ? ticks[i] : converted;
+                }
+
+                out[i] = static_cast<ticks_type>(result);
+                hits[count] = i;
+                count += overflow;
+            }
+            overflowed.insert(overflowed.end(), hits.begin(), hits.begin() + count);
+            total += count;
+        }
+
+        return total;
+    }
+
+    [[noreturn]] static constexpr void throw_parse_error(string_view_type tc, fps_type fps, ParseError error) {
+        CXXTC_THROW(std::format("failed to construct timecode from string \"{}\" with fps value \"{}\": {}", tc, fps.as_underlying(), parse_error_name(error)));
+    }
+
+    // Ticks to samples: ticks * rate_denominator * sample_rate
+    // / (rate_numerator * TICK_RATE); inverse swaps the two.
+    static constexpr __arith::ExactScale samples_scale(fps_type fps, std::uint64_t sample_rate, SnapMode snap, bool inverse = false) {
+        auto const numerator = fps_enum_type::rate_denominator<std::uint64_t>(fps) * sample_rate;
+        auto const denominator = fps_enum_type::rate_numerator<std::uint64_t>(fps) * TICK_RATE;
+        return inverse ? __arith::ExactScale::make(denominator, numerator, snap) : __arith::ExactScale::make(numerator, denominator, snap);
+    }
+
+    // Ticks to counts of Period, as samples_scale() with Period::den / Period::num
+    // in place of the sample rate.
+    template<typename Period>
+    static constexpr __arith::ExactScale duration_scale(fps_type fps, SnapMode snap, bool inverse = false) {
+        auto const numerator = fps_enum_type::rate_denominator<std::uint64_t>(fps) * static_cast<std::uint64_t>(Period::den);
+        auto const denominator = fps_enum_type::rate_numerator<std::uint64_t>(fps) * TICK_RATE * static_cast<std::uint64_t>(Period::num);
+        return inverse ? __arith::ExactScale::make(denominator, numerator, snap) : __arith::ExactScale::make(numerator, denominator, snap);
+    }
+
+    static std::size_t scale_to_ticks(
+        span_type<std::uint64_t const, std::dynamic_extent> values,
+        __arith::ExactScale const& scale,
+        fps_type fps,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed
+    ) {
+        auto const day = static_cast<std::uint64_t>(TICKS_MAX(fps));
+        std::size_t converted = 0;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            auto const ticks = scale.apply(values[i]);
+            out[i] = (ticks <= day) ? static_cast<ticks_type>(ticks) : 0;
+            if (ticks <= day) { converted += 1; } else { failed.push_back(i); }
+        }
+        return converted;
+    }
+
+    // Table-driven BCD decode shared by from_bcd() and bcds_to_ticks().
+    static constexpr std::optional<ticks_type> bcd_to_ticks(std::uint32_t bcd, ticks_type fps_unsigned, ticks_type dropped, bool drop_frame) noexcept {
+        ticks_type const hours = __smpte::BCD_TO_BINARY[(bcd >> 24) & __smpte::BCD_HOURS_MASK];
+        ticks_type const minutes = __smpte::BCD_TO_BINARY[(bcd >> 16) & __smpte::BCD_MINUTES_MASK];
+        ticks_type const seconds = __smpte::BCD_TO_BINARY[(bcd >> 8) & __smpte::BCD_SECONDS_MASK];
+        ticks_type const frames = __smpte::BCD_TO_BINARY[bcd & __smpte::BCD_FRAMES_MASK];
+
+        auto const valid = hours < CXXTC_HRS_MAX && minutes <= CXXTC_MINS_MAX && seconds <= CXXTC_SECS_MAX && frames < fps_unsigned
+                        && ((bcd & __smpte::BCD_DROP_FRAME_BIT) != 0) == drop_frame
+                        && __arith::drop_frame_label_valid(minutes, seconds, frames, dropped);
+        if (!valid) { return std::nullopt; }
+
+        return hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE)
+             + minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE)
+             + seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE)
+             + frames * CXXTC_1FRAME_TICKS(TICK_RATE)
+             - __arith::drop_frame_offset(hours * 60 + minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+#if defined(CXXTC_HAS_SSE42)
+    static std::size_t store_parsed_fields(
+        __simd::ParsedFields const& fields,
+        ticks_type fps_unsigned,
+        ticks_type dropped,
+        std::size_t index,
+        span_type<ticks_type, std::dynamic_extent> out,
+        dynamic_array_type<std::size_t>& failed
+    ) {
+        ticks_type const hours = fields.hours;
+        ticks_type const minutes = fields.minutes;
+        ticks_type const seconds = fields.seconds;
+        ticks_type const frames = fields.frames;
+        ticks_type const ticks = hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE)
+                               + minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE)
+                               + seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE)
+                               + frames * CXXTC_1FRAME_TICKS(TICK_RATE)
+                               + BasicTimecode::subframe_to_ticks(fields.ticks)
+                               - __arith::drop_frame_offset(hours * 60 + minutes, dropped) * CXXTC_1FRAME_TICKS(TICK_RATE);
+        auto const valid = fields.valid && __arith::drop_frame_label_valid(minutes, seconds, frames, dropped);
+        out[index] = valid ? ticks : 0;
+        if (!valid) { failed.push_back(index); }
+        return valid;
+    }
+#endif
+
+    fps_type _fps;
+    ticks_type _ticks;
+    flags_type _flags;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION StaticTimecode Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Timecode with its frame rate fixed at compile time. Every divisor and bound
+// is a constant expression, so the accessors compile down to multiplies and
+// shifts, and only the ticks are stored. Converts to and from BasicTimecode
+// of the same ticks type.
+template<Fps::Variant FPS, std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct StaticTimecode {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using flags_type = typename timecode_type::flags_type;
+    using string_type = typename timecode_type::string_type;
+    using string_view_type = typename timecode_type::string_view_type;
+
+    static constexpr fps_variant_type FPS_VARIANT = FPS;
+    static constexpr ticks_type TICK_RATE = timecode_type::TICK_RATE;
+    static constexpr ticks_type FPS_UNSIGNED = fps_enum_type::template to_unsigned<ticks_type>(FPS);
+    static constexpr ticks_type DROPPED_FRAMES = fps_enum_type::template dropped_frames<ticks_type>(FPS);
+    static constexpr ticks_type TICKS_MAX = timecode_type::TICKS_MAX(FPS);
+    static constexpr flags_type FLAGS = (fps_enum_type::drop_frame(FPS)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
+
+public:
+    constexpr StaticTimecode() noexcept
+        : _ticks(CXXTC_TICKS_DEFAULT)
+    {}
+
+    constexpr StaticTimecode(string_view_type tc)
+        : _ticks(timecode_type{ tc, FPS }.ticks())
+    {}
+
+private:
+    explicit constexpr StaticTimecode(ticks_type ticks) noexcept
+        : _ticks(ticks)
+    {}
+
+public:
+    static constexpr std::optional<ticks_type> timecode_to_ticks(string_view_type tc) noexcept {
+        return timecode_type::timecode_to_ticks(tc, FPS);
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_ticks(T ticks) noexcept {
+        if (ticks > TICKS_MAX) { return std::nullopt; }
+        return StaticTimecode{ static_cast<ticks_type>(ticks) };
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_ticks_unchecked(T ticks) noexcept {
+        return StaticTimecode{ static_cast<ticks_type>(ticks) };
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_frames(T frames) noexcept {
+        return StaticTimecode::from_ticks(frames * CXXTC_1FRAME_TICKS(TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_frames_unchecked(T frames) noexcept {
+        return StaticTimecode::from_ticks_unchecked(frames * CXXTC_1FRAME_TICKS(TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_seconds(T seconds) noexcept {
+        return StaticTimecode::from_ticks(seconds * CXXTC_1SEC_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_seconds_unchecked(T seconds) noexcept {
+        return StaticTimecode::from_ticks_unchecked(seconds * CXXTC_1SEC_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_minutes(T minutes) noexcept {
+        return StaticTimecode::from_ticks(minutes * CXXTC_1MIN_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_minutes_unchecked(T minutes) noexcept {
+        return StaticTimecode::from_ticks_unchecked(minutes * CXXTC_1MIN_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_hours(T hours) noexcept {
+        return StaticTimecode::from_ticks(hours * CXXTC_1HR_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_hours_unchecked(T hours) noexcept {
+        return StaticTimecode::from_ticks_unchecked(hours * CXXTC_1HR_TICKS(FPS_UNSIGNED, TICK_RATE));
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr std::optional<StaticTimecode> from_hmsf(T hours, T minutes, T seconds, T frames) noexcept {
+        auto const tc = timecode_type::from_hmsf(hours, minutes, seconds, frames, FPS);
+        if (!tc.has_value()) { return std::nullopt; }
+        return StaticTimecode{ tc->ticks() };
+    }
+
+    template<std::unsigned_integral T>
+    static constexpr StaticTimecode from_hmsf_unchecked(T hours, T minutes, T seconds, T frames) noexcept {
+        ticks_type ticks = 0;
+        ticks += (hours * CXXTC_1HR_TICKS(FPS_UNSIGNED, TICK_RATE));
+        ticks += (minutes * CXXTC_1MIN_TICKS(FPS_UNSIGNED, TICK_RATE));
+        ticks += (seconds * CXXTC_1SEC_TICKS(FPS_UNSIGNED, TICK_RATE));
+        ticks += (frames * CXXTC_1FRAME_TICKS(TICK_RATE));
+        ticks -= __arith::drop_frame_offset<ticks_type>(hours * 60 + minutes, DROPPED_FRAMES) * CXXTC_1FRAME_TICKS(TICK_RATE);
+        return StaticTimecode::from_ticks_unchecked(ticks);
+    }
+
+    static constexpr std::optional<StaticTimecode> from_string(string_view_type tc) noexcept {
+        auto const ticks = StaticTimecode::timecode_to_ticks(tc);
+        if (!ticks.has_value()) { return std::nullopt; }
+        return StaticTimecode{ ticks.value() };
+    }
+
+    // Fails when tc was not taken at this timecode's frame rate.
+    static constexpr std::optional<StaticTimecode> from_basic(timecode_type const& tc) noexcept {
+        if (tc.fps() != fps_type{ FPS }) { return std::nullopt; }
+        return StaticTimecode{ tc.ticks() };
+    }
+
+    constexpr timecode_type to_basic() const noexcept {
+        return timecode_type::from_ticks_unchecked(_ticks, FPS);
+    }
+
+    constexpr operator timecode_type() const noexcept {
+        return to_basic();
+    }
+
+    constexpr char* format_to(char* out, TimecodeForm form = TimecodeForm::REGULAR) const noexcept {
+        auto const frames_delimiter = (FLAGS & CXXTC_FLAG_DROPFRAME) ? ';' : ':';
+        return __text::write_timecode(
+            out,
+            hours_part(), minutes_part(), seconds_part(), frames_part(), timecode_type::ticks_to_subframe(ticks_part()),
+            form == TimecodeForm::EXTENDED,
+            frames_delimiter
+        );
+    }
+
+    template<typename S = std::string>
+    constexpr S to_string(TimecodeForm form = TimecodeForm::REGULAR) const {
+        return to_basic().template to_string<S>(form);
+    }
+
+    constexpr ticks_type hours_part() const noexcept {
+        return label_ticks() / CXXTC_1HR_TICKS(FPS_UNSIGNED, TICK_RATE);
+    }
+
+    constexpr ticks_type minutes_part() const noexcept {
+        return (label_ticks() % CXXTC_1HR_TICKS(FPS_UNSIGNED, TICK_RATE)) / CXXTC_1MIN_TICKS(FPS_UNSIGNED, TICK_RATE);
+    }
+
+    constexpr ticks_type seconds_part() const noexcept {
+        return (label_ticks() % CXXTC_1MIN_TICKS(FPS_UNSIGNED, TICK_RATE)) / CXXTC_1SEC_TICKS(FPS_UNSIGNED, TICK_RATE);
+    }
+
+    constexpr ticks_type frames_part() const noexcept {
+        return (label_ticks() % CXXTC_1SEC_TICKS(FPS_UNSIGNED, TICK_RATE)) / CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    constexpr ticks_type ticks_part() const noexcept {
+        return _ticks % CXXTC_1FRAME_TICKS(TICK_RATE);
+    }
+
+    constexpr typename timecode_type::Parts parts() const {
+        return to_basic().parts();
+    }
+
+    constexpr ticks_type label_ticks() const noexcept {
+        if constexpr (DROPPED_FRAMES == 0) {
+            return _ticks;
+        } else {
+            auto const frames = __arith::drop_frame_to_label(_ticks / CXXTC_1FRAME_TICKS(TICK_RATE), FPS_UNSIGNED, DROPPED_FRAMES);
+            return frames * CXXTC_1FRAME_TICKS(TICK_RATE) + _ticks % CXXTC_1FRAME_TICKS(TICK_RATE);
+        }
+    }
+
+    inline constexpr fps_type fps() const noexcept {
+        return FPS;
+    }
+
+    inline constexpr ticks_type ticks() const noexcept {
+        return _ticks;
+    }
+
+    inline constexpr flags_type flags() const noexcept {
+        return FLAGS;
+    }
+
+    constexpr auto operator<=>(StaticTimecode const&) const noexcept = default;
+
+private:
+    ticks_type _ticks;
+};
+
+namespace literals {
+
+// String literal captured as a template argument, so that literal operators
+// can parse it during constant evaluation.
+template<std::size_t N>
+struct FixedString {
+    char data[N];
+
+    consteval FixedString(char const (&string)[N]) {
+        std::copy_n(string, N, data);
+    }
+
+    consteval std::string_view view() const noexcept { return { data, N - 1 }; }
+};
+
+// Parses a literal with the checked parser while compiling. A malformed
+// literal reaches the throw, which is not a constant expression, so it is
+// rejected as a compile error.
+template<Fps::Variant FPS, FixedString S>
+consteval StaticTimecode<FPS> make_timecode_literal() {
+    auto const ticks = StaticTimecode<FPS>::timecode_to_ticks(S.view());
+    if (!ticks.has_value()) {
+        CXXTC_THROW("malformed timecode literal");
+    }
+    return StaticTimecode<FPS>::from_ticks_unchecked(ticks.value());
+}
+
+template<FixedString S> consteval auto operator""_tc23976() { return make_timecode_literal<Fps::F_23P976_NDF, S>(); }
+template<FixedString S> consteval auto operator""_tc23976df() { return make_timecode_literal<Fps::F_23P976_DF, S>(); }
+template<FixedString S> consteval auto operator""_tc24() { return make_timecode_literal<Fps::F_24, S>(); }
+template<FixedString S> consteval auto operator""_tc25() { return make_timecode_literal<Fps::F_25, S>(); }
+template<FixedString S> consteval auto operator""_tc2997() { return make_timecode_literal<Fps::F_29P97_NDF, S>(); }
+template<FixedString S> consteval auto operator""_tc2997df() { return make_timecode_literal<Fps::F_29P97_DF, S>(); }
+template<FixedString S> consteval auto operator""_tc30() { return make_timecode_literal<Fps::F_30, S>(); }
+
+} // @END OF namespace literals
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION PackedTimecode Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// A timecode packed into one unsigned word: from the most significant bit,
+// 3 bits of rate family (23.976, 24, 25, 29.97, 30), 1 drop-frame bit and
+// the ticks. Trivially copyable, so it fits in hash tables and lock-free
+// atomics, and ordered by rate, then drop-frame, then ticks. Word must be
+// wide enough for a day of ticks of the BasicTimecode it round-trips with.
+template<
+    std::unsigned_integral Word = std::uint64_t,
+    std::unsigned_integral IntType = std::uint32_t,
+    std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT
+>
+struct PackedTimecode {
+    using word_type = Word;
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+
+    static constexpr unsigned RATE_BITS = 3;
+    static constexpr unsigned DROP_FRAME_BITS = 1;
+    static constexpr unsigned TICKS_BITS = std::numeric_limits<word_type>::digits - RATE_BITS - DROP_FRAME_BITS;
+    static constexpr word_type TICKS_MASK = (word_type{ 1 } << TICKS_BITS) - 1;
+    static constexpr word_type DROP_FRAME_BIT = word_type{ 1 } << TICKS_BITS;
+
+    static_assert(
+        std::bit_width(static_cast<std::uint64_t>(timecode_type::NOMINAL_TICKS_MAX(fps_enum_type::F_30))) <= TICKS_BITS,
+        "word type cannot hold 24 hours of ticks at this tick rate"
+    );
+
+public:
+    constexpr PackedTimecode() noexcept = default;
+
+    // Fails for ticks that do not fit, which only unchecked timecodes far
+    // beyond 24 hours can hold.
+    static constexpr std::optional<PackedTimecode> from_basic(timecode_type const& tc) noexcept {
+        if (static_cast<std::uint64_t>(tc.ticks()) > TICKS_MASK) { return std::nullopt; }
+        auto const drop_frame = fps_enum_type::drop_frame(tc.fps()) ? DROP_FRAME_BIT : word_type{ 0 };
+        return PackedTimecode{ (rate_code(tc.fps()) << (TICKS_BITS + DROP_FRAME_BITS)) | drop_frame | static_cast<word_type>(tc.ticks()) };
+    }
+
+    static constexpr PackedTimecode from_basic_unchecked(timecode_type const& tc) {
+        auto const packed = PackedTimecode::from_basic(tc);
+        if (!packed.has_value()) {
+            CXXTC_THROW(std::format("timecode with ticks {} does not fit in {} bits", tc.ticks(), TICKS_BITS));
+        }
+        return packed.value();
+    }
+
+    // Fails for words that no timecode packs into: an unknown rate or a
+    // drop-frame bit on an integer rate. Any ticks are accepted, as in
+    // from_basic(), so every packed word round-trips.
+    static constexpr std::optional<PackedTimecode> from_word(word_type word) noexcept {
+        auto const code = word >> (TICKS_BITS + DROP_FRAME_BITS);
+        auto const drop_frame = (word & DROP_FRAME_BIT) != 0;
+        auto const fractional = code == RATE_23P976 || code == RATE_29P97;
+        if (code > RATE_30 || (drop_frame && !fractional)) { return std::nullopt; }
+        return PackedTimecode{ word };
+    }
+
+    constexpr timecode_type to_basic() const {
+        return timecode_type::from_ticks_unchecked(ticks(), fps());
+    }
+
+    constexpr operator timecode_type() const {
+        return to_basic();
+    }
+
+    constexpr fps_type fps() const noexcept {
+        auto const drop_frame = drop_frame_bit();
+        switch (_word >> (TICKS_BITS + DROP_FRAME_BITS)) {
+            case RATE_23P976: return drop_frame ? fps_enum_type::F_23P976_DF : fps_enum_type::F_23P976_NDF;
+            case RATE_24: return fps_enum_type::F_24;
+            case RATE_25: return fps_enum_type::F_25;
+            case RATE_29P97: return drop_frame ? fps_enum_type::F_29P97_DF : fps_enum_type::F_29P97_NDF;
+            default: return fps_enum_type::F_30;
+        }
+    }
+
+    inline constexpr ticks_type ticks() const noexcept { return static_cast<ticks_type>(_word & TICKS_MASK); }
+    inline constexpr bool drop_frame_bit() const noexcept { return (_word & DROP_FRAME_BIT) != 0; }
+    inline constexpr word_type word() const noexcept { return _word; }
+
+    constexpr auto operator<=>(PackedTimecode const&) const noexcept = default;
+
+private:
+    static constexpr word_type RATE_23P976 = 0;
+    static constexpr word_type RATE_24 = 1;
+    static constexpr word_type RATE_25 = 2;
+    static constexpr word_type RATE_29P97 = 3;
+    static constexpr word_type RATE_30 = 4;
+
+    explicit constexpr PackedTimecode(word_type word) noexcept
+        : _word(word)
+    {}
+
+    static constexpr word_type rate_code(fps_type fps) noexcept {
+        switch (fps) {
+            case fps_enum_type::F_23P976_DF:
+            case fps_enum_type::F_23P976_NDF: return RATE_23P976;
+            case fps_enum_type::F_24: return RATE_24;
+            case fps_enum_type::F_25: return RATE_25;
+            case fps_enum_type::F_29P97_DF:
+            case fps_enum_type::F_29P97_NDF: return RATE_29P97;
+            default: return RATE_30;
+        }
+    }
+
+    word_type _word = 0;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeColumn Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Struct-of-arrays container for many timecodes at a single frame rate. The
+// rate and flags are stored once, and the timecodes themselves only as a
+// contiguous array of ticks, so each entry costs sizeof(ticks_type). Elements
+// are read back as BasicTimecode values viewed through the shared rate.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeColumn {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using flags_type = typename timecode_type::flags_type;
+    using string_view_type = typename timecode_type::string_view_type;
+    using offset_type = typename timecode_type::offset_type;
+    using container_type = std::vector<ticks_type>;
+    using size_type = std::size_t;
+
+    template<typename T, std::size_t N = std::dynamic_extent>
+    using span_type = std::span<T, N>;
+
+    static constexpr std::size_t LOAD_CHUNK_SIZE = 1 << 20;
+
+    struct iterator {
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = timecode_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = timecode_type;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr iterator(ticks_type const* ticks, fps_variant_type fps) noexcept
+            : _ticks(ticks)
+            , _fps(fps)
+        {}
+
+        constexpr timecode_type operator*() const { return timecode_type::from_ticks_unchecked(*_ticks, _fps); }
+        constexpr timecode_type operator[](difference_type n) const { return *(*this + n); }
+
+        constexpr iterator& operator++() noexcept { ++_ticks; return *this; }
+        constexpr iterator operator++(int) noexcept { auto copy = *this; ++_ticks; return copy; }
+        constexpr iterator& operator--() noexcept { --_ticks; return *this; }
+        constexpr iterator operator--(int) noexcept { auto copy = *this; --_ticks; return copy; }
+        constexpr iterator& operator+=(difference_type n) noexcept { _ticks += n; return *this; }
+        constexpr iterator& operator-=(difference_type n) noexcept { _ticks -= n; return *this; }
+
+        friend constexpr iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend constexpr iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend constexpr iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend constexpr difference_type operator-(iterator const& lhs, iterator const& rhs) noexcept { return lhs._ticks - rhs._ticks; }
+        friend constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept { return lhs._ticks == rhs._ticks; }
+        friend constexpr auto operator<=>(iterator const& lhs, iterator const& rhs) noexcept { return lhs._ticks <=> rhs._ticks; }
+
+    private:
+        ticks_type const* _ticks = nullptr;
+        fps_variant_type _fps = fps_enum_type::F_25;
+    };
+
+    using const_iterator = iterator;
+
+public:
+    TimecodeColumn() = delete;
+
+    explicit TimecodeColumn(fps_type fps)
+        : _fps(fps.as_variant())
+        , _flags((fps_enum_type::drop_frame(fps)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT)
+        , _ticks()
+    {}
+
+    TimecodeColumn(fps_type fps, span_type<ticks_type const> ticks)
+        : TimecodeColumn(fps)
+    {
+        append(ticks);
+    }
+
+    // Appends tc, which must have been taken at the column's frame rate.
+    void push_back(timecode_type const& tc) {
+        if (tc.fps() != fps()) {
+            CXXTC_THROW(std::format("timecode with fps value \"{}\" does not match column fps value \"{}\"", tc.fps().as_underlying(), fps().as_underlying()));
+        }
+        _ticks.push_back(tc.ticks());
+    }
+
+    void push_back(ticks_type ticks) {
+        _ticks.push_back(ticks);
+    }
+
+    void append(span_type<ticks_type const> ticks) {
+        _ticks.insert(_ticks.end(), ticks.begin(), ticks.end());
+    }
+
+    // Parses every string in tcs with timecode_to_ticks() rules and appends
+    // the ones that succeed, in order. The indices into tcs of the strings
+    // that fail are appended to failed. Returns the number appended.
+    size_type parse(span_type<string_view_type const> tcs, std::vector<std::size_t>& failed) {
+        auto const offset = _ticks.size();
+        auto const failed_offset = failed.size();
+        _ticks.resize(offset + tcs.size());
+        auto const parsed = timecode_type::timecodes_to_ticks(tcs, fps(), span_type<ticks_type>(_ticks).subspan(offset), failed);
+        compact(offset, span_type<std::size_t const>(failed).subspan(failed_offset));
+        return parsed;
+    }
+
+    // Same as above, for count records of width bytes at a fixed stride in
+    // one packed buffer; see BasicTimecode::timecodes_to_ticks().
+    size_type parse(string_view_type packed, std::size_t width, std::size_t stride, size_type count, std::vector<std::size_t>& failed) {
+        auto const offset = _ticks.size();
+        auto const failed_offset = failed.size();
+        _ticks.resize(offset + count);
+        auto const parsed = timecode_type::timecodes_to_ticks(packed, width, stride, fps(), span_type<ticks_type>(_ticks).subspan(offset), failed);
+        compact(offset, span_type<std::size_t const>(failed).subspan(failed_offset));
+        return parsed;
+    }
+
+    // Parses newline-delimited timecode text with timecode_to_ticks() rules.
+    // The text is split into line-aligned chunks of about chunk_size bytes
+    // which are parsed in parallel on up to thread_count threads (0 picks
+    // the hardware concurrency). A trailing "\r" on a line is ignored. The
+    // 1-based numbers of lines that fail to parse are appended to
+    // rejected_lines in ascending order.
+    static TimecodeColumn from_lines(
+        string_view_type text,
+        fps_type fps,
+        std::vector<std::size_t>& rejected_lines,
+        std::size_t thread_count = 0,
+        std::size_t chunk_size = LOAD_CHUNK_SIZE
+    ) {
+        auto const chunks = __io::split_lines(text, text.size() / std::max<std::size_t>(chunk_size, 1));
+        std::vector<TimecodeColumn> columns(chunks.size(), TimecodeColumn{ fps });
+        std::vector<std::vector<std::size_t>> failed(chunks.size());
+        std::vector<std::size_t> line_counts(chunks.size(), 0);
+
+        __parallel::for_each_stealing(chunks.size(), thread_count, [&](std::size_t chunk_index) {
+            auto chunk = chunks[chunk_index];
+            std::vector<string_view_type> lines;
+            while (!chunk.empty()) {
+                auto const newline = chunk.find('\n');
+                auto line = chunk.substr(0, newline);
+                if (!line.empty() && line.back() == '\r') { line.remove_suffix(1); }
+                lines.push_back(line);
+                chunk.remove_prefix((newline == string_view_type::npos) ? chunk.size() : newline + 1);
+            }
+            line_counts[chunk_index] = lines.size();
+            columns[chunk_index].parse(lines, failed[chunk_index]);
+        });
+
+        TimecodeColumn column{ fps };
+        std::size_t total = 0;
+        for (auto const& chunk_column : columns) { total += chunk_column.size(); }
+        column.reserve(total);
+
+        std::size_t first_line = 1;
+        for (std::size_t i = 0; i < chunks.size(); ++i) {
+            column.append(columns[i].ticks());
+            for (auto const index : failed[i]) { rejected_lines.push_back(first_line + index); }
+            first_line += line_counts[i];
+        }
+
+        return column;
+    }
+
+    // Same as from_lines(), reading the text from the file at path, which is
+    // memory-mapped rather than read through a stream. Throws if the file
+    // cannot be opened.
+    static TimecodeColumn from_file(
+        char const* path,
+        fps_type fps,
+        std::vector<std::size_t>& rejected_lines,
+        std::size_t thread_count = 0,
+        std::size_t chunk_size = LOAD_CHUNK_SIZE
+    ) {
+        __io::MappedFile const file{ path };
+        return from_lines(file.view(), fps, rejected_lines, thread_count, chunk_size);
+    }
+
+    // Adds delta ticks to every timecode in place; see
+    // BasicTimecode::offset_ticks(). Returns the number that overflowed.
+    size_type offset(offset_type delta, OverflowPolicy policy, std::vector<std::size_t>& overflowed) {
+        return timecode_type::offset_ticks(_ticks, delta, fps(), _ticks, policy, overflowed);
+    }
+
+    // Retimes every timecode in place to the rate to, which becomes the
+    // column's rate; see BasicTimecode::convert_ticks(). Under REPORT the
+    // timecodes that overflow are removed, since they cannot be kept at the
+    // old rate; their indices before removal are still appended.
+    size_type convert(fps_type to, SnapMode snap, OverflowPolicy policy, std::vector<std::size_t>& overflowed) {
+        auto const overflowed_offset = overflowed.size();
+        auto const count = timecode_type::convert_ticks(_ticks, fps(), to, _ticks, snap, policy, overflowed);
+        if (policy == OverflowPolicy::REPORT) { compact(0, span_type<std::size_t const>(overflowed).subspan(overflowed_offset)); }
+        _fps = to.as_variant();
+        _flags = (fps_enum_type::drop_frame(to)) ? CXXTC_FLAG_DROPFRAME : CXXTC_FLAG_DEFAULT;
+        return count;
+    }
+
+    // Moves every timecode by to - from, e.g. to rebase a reel starting at
+    // 10:00:00:00 onto 01:00:00:00. Both must be at the column's rate.
+    size_type rebase(timecode_type const& from, timecode_type const& to, OverflowPolicy policy, std::vector<std::size_t>& overflowed) {
+        if (from.fps() != fps() || to.fps() != fps()) {
+            CXXTC_THROW(std::format("rebase fps values \"{}\" and \"{}\" do not match column fps value \"{}\"", from.fps().as_underlying(), to.fps().as_underlying(), fps().as_underlying()));
+        }
+        auto const delta = static_cast<offset_type>(to.ticks()) - static_cast<offset_type>(from.ticks());
+        return offset(delta, policy, overflowed);
+    }
+
+    size_type formatted_size(TimecodeForm form = TimecodeForm::REGULAR, bool newline = false) const noexcept {
+        return timecode_type::formatted_size(size(), form, newline);
+    }
+
+    // Writes every timecode as fixed-width text into out, which must hold at
+    // least formatted_size(form, newline) characters.
+    size_type format(span_type<char> out, TimecodeForm form = TimecodeForm::REGULAR, bool newline = false) const {
+        return timecode_type::ticks_to_timecodes(ticks(), fps(), out, form, newline);
+    }
+
+    // Writes the audio sample index of every timecode at sample_rate into
+    // out; see BasicTimecode::to_samples().
+    void to_samples(std::uint64_t sample_rate, span_type<std::uint64_t> out, SnapMode snap = SnapMode::NEAREST) const {
+        timecode_type::ticks_to_samples(ticks(), fps(), sample_rate, out, snap);
+    }
+
+    // Writes the real time of every timecode into out; see
+    // BasicTimecode::to_duration().
+    template<typename Duration>
+    void to_durations(span_type<Duration> out, SnapMode snap = SnapMode::NEAREST) const {
+        timecode_type::ticks_to_durations(ticks(), fps(), out, snap);
+    }
+
+    // Column at fps of the timecodes that audio sample indices at
+    // sample_rate fall on. The indices into samples of values past the end
+    // of the day are appended to rejected and left out.
+    static TimecodeColumn from_samples(
+        span_type<std::uint64_t const> samples,
+        std::uint64_t sample_rate,
+        fps_type fps,
+        std::vector<std::size_t>& rejected,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        container_type ticks(samples.size());
+        auto const first_rejected = rejected.size();
+        timecode_type::samples_to_ticks(samples, sample_rate, fps, ticks, rejected, snap);
+        TimecodeColumn column{ fps };
+        column._ticks = std::move(ticks);
+        column.compact(0, span_type<std::size_t const>{ rejected }.subspan(first_rejected));
+        return column;
+    }
+
+    // As from_samples(), for real times since 00:00:00:00.
+    template<typename Duration>
+    static TimecodeColumn from_durations(
+        span_type<Duration const> durations,
+        fps_type fps,
+        std::vector<std::size_t>& rejected,
+        SnapMode snap = SnapMode::NEAREST
+    ) {
+        container_type ticks(durations.size());
+        auto const first_rejected = rejected.size();
+        timecode_type::durations_to_ticks(durations, fps, ticks, rejected, snap);
+        TimecodeColumn column{ fps };
+        column._ticks = std::move(ticks);
+        column.compact(0, span_type<std::size_t const>{ rejected }.subspan(first_rejected));
+        return column;
+    }
+
+    // Decomposes every timecode into five struct-of-arrays columns; see
+    // BasicTimecode::ticks_to_parts().
+    void parts(
+        span_type<ticks_type> hours,
+        span_type<ticks_type> minutes,
+        span_type<ticks_type> seconds,
+        span_type<ticks_type> frames,
+        span_type<ticks_type> ticks_parts
+    ) const {
+        timecode_type::ticks_to_parts(ticks(), fps(), hours, minutes, seconds, frames, ticks_parts);
+    }
+
+    // Joins two ascending columns on equal real time; see
+    // BasicTimecode::merge_join().
+    template<typename OnMatch>
+    void merge_join(TimecodeColumn const& other, OnMatch&& on_match) const {
+        timecode_type::merge_join(ticks(), fps(), other.ticks(), other.fps(), std::forward<OnMatch>(on_match));
+    }
+
+    timecode_type operator[](size_type i) const {
+        return timecode_type::from_ticks_unchecked(_ticks[i], _fps);
+    }
+
+    iterator begin() const noexcept { return iterator{ _ticks.data(), _fps }; }
+    iterator end() const noexcept { return iterator{ _ticks.data() + _ticks.size(), _fps }; }
+
+    void reserve(size_type capacity) { _ticks.reserve(capacity); }
+    void clear() noexcept { _ticks.clear(); }
+
+    inline size_type size() const noexcept { return _ticks.size(); }
+    inline bool empty() const noexcept { return _ticks.empty(); }
+    inline span_type<ticks_type const> ticks() const noexcept { return _ticks; }
+    inline span_type<ticks_type> ticks() noexcept { return _ticks; }
+    inline fps_type fps() const noexcept { return _fps; }
+    inline flags_type flags() const noexcept { return _flags; }
+
+private:
+    // Removes the entries of the failed records, which are sorted and
+    // relative to offset, in a single pass.
+    void compact(size_type offset, span_type<std::size_t const> failed) {
+        if (failed.empty()) { return; }
+
+        auto write = offset + failed.front();
+        for (std::size_t i = 0; i < failed.size(); ++i) {
+            auto const begin = offset + failed[i] + 1;
+            auto const end = (i + 1 < failed.size()) ? offset + failed[i + 1] : _ticks.size();
+            for (auto read = begin; read < end; ++read) { _ticks[write++] = _ticks[read]; }
+        }
+        _ticks.resize(write);
+    }
+
+    fps_variant_type _fps;
+    flags_type _flags;
+    container_type _ticks;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeStreamParser Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Resumable parser for newline-delimited timecodes that arrive as arbitrary
+// byte chunks, e.g. from a socket or serial port. Only the bytes of a record
+// that straddles a chunk boundary are carried between calls, in a fixed
+// buffer, so the parser never allocates. Every record is validated with
+// timecode_to_ticks() rules; a trailing "\r" is ignored.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeStreamParser {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using string_view_type = typename timecode_type::string_view_type;
+
+    // Room for the longest valid record plus its "\r".
+    static constexpr std::size_t BUFFER_SIZE = timecode_type::STRING_SIZE_EXTENDED + 1;
+
+public:
+    TimecodeStreamParser() = delete;
+
+    explicit constexpr TimecodeStreamParser(fps_type fps) noexcept
+        : _fps(fps.as_variant())
+    {}
+
+    // Consumes bytes, calling on_record(record, ticks) for each record that
+    // is completed by a newline, in order. record is the 0-based index of the
+    // record in the stream and ticks is std::nullopt if it failed to parse.
+    template<typename OnRecord>
+    constexpr void push(string_view_type bytes, OnRecord&& on_record) {
+        while (!bytes.empty()) {
+            auto const newline = bytes.find('\n');
+            if (newline == string_view_type::npos) {
+                carry(bytes);
+                return;
+            }
+
+            auto const line = bytes.substr(0, newline);
+            bytes.remove_prefix(newline + 1);
+
+            if (_size == 0) {
+                // Whole record inside this chunk, parsed in place.
+                emit(line, on_record);
+            } else {
+                carry(line);
+                emit(string_view_type{ _buffer.data(), std::min(_size, BUFFER_SIZE) }, on_record, _size > BUFFER_SIZE);
+                _size = 0;
+            }
+        }
+    }
+
+    // Ends the stream, emitting the final record if it was not terminated
+    // by a newline.
+    template<typename OnRecord>
+    constexpr void finish(OnRecord&& on_record) {
+        if (_size > 0) {
+            emit(string_view_type{ _buffer.data(), std::min(_size, BUFFER_SIZE) }, on_record, _size > BUFFER_SIZE);
+        }
+        reset();
+    }
+
+    // Drops any partial record and restarts record numbering.
+    constexpr void reset() noexcept {
+        _size = 0;
+        _records = 0;
+    }
+
+    inline constexpr std::size_t records() const noexcept { return _records; }
+    inline constexpr bool pending() const noexcept { return _size > 0; }
+    inline constexpr fps_type fps() const noexcept { return _fps; }
+
+private:
+    // Buffers the bytes of a partial record. Bytes past BUFFER_SIZE are only
+    // counted, which is enough to reject the record once it completes.
+    constexpr void carry(string_view_type bytes) noexcept {
+        if (_size < BUFFER_SIZE) {
+            auto const count = std::min(bytes.size(), BUFFER_SIZE - _size);
+            std::copy_n(bytes.data(), count, _buffer.data() + _size);
+        }
+        _size += bytes.size();
+    }
+
+    template<typename OnRecord>
+    constexpr void emit(string_view_type line, OnRecord& on_record, bool overflow = false) {
+        if (!line.empty() && line.back() == '\r') { line.remove_suffix(1); }
+        auto const ticks = (overflow) ? std::nullopt : timecode_type::timecode_to_ticks(line, _fps);
+        on_record(_records++, ticks);
+    }
+
+    fps_variant_type _fps;
+    std::array<char, BUFFER_SIZE> _buffer = {};
+    std::size_t _size = 0;
+    std::size_t _records = 0;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeIntervalIndex Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Immutable index over [in, out) ticks ranges at one frame rate, answering
+// point ("which events cover X") and overlap ("which events overlap [A, B)")
+// queries in O(log n + k). The events are stored as flat arrays sorted by
+// in, which double as an implicit balanced binary tree: the node at index i
+// of level k has children i -/+ 2^(k-1) and stores the largest out in its
+// subtree, so whole subtrees that end before a query are skipped. Building
+// sorts once; nothing is allocated per node or per query.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeIntervalIndex {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using size_type = std::size_t;
+
+    template<typename T, std::size_t N = std::dynamic_extent>
+    using span_type = std::span<T, N>;
+
+public:
+    TimecodeIntervalIndex() = delete;
+
+    // Event i is [ins[i], outs[i]), and queries report it by its index i.
+    // Empty events, where out <= in, are never reported.
+    TimecodeIntervalIndex(fps_type fps, span_type<ticks_type const> ins, span_type<ticks_type const> outs)
+        : _fps(fps.as_variant())
+    {
+        if (ins.size() != outs.size()) {
+            CXXTC_THROW(std::format("interval index needs as many ins as outs, got {} and {}", ins.size(), outs.size()));
+        }
+
+        for (std::size_t i = 0; i < ins.size(); ++i) {
+            if (ins[i] < outs[i]) { _ids.push_back(i); }
+        }
+        std::ranges::sort(_ids, [&](std::size_t lhs, std::size_t rhs) {
+            return (ins[lhs] < ins[rhs]) || (ins[lhs] == ins[rhs] && outs[lhs] < outs[rhs]);
+        });
+
+        _ins.reserve(_ids.size());
+        _outs.reserve(_ids.size());
+        for (auto const id : _ids) {
+            _ins.push_back(ins[id]);
+            _outs.push_back(outs[id]);
+        }
+        build();
+    }
+
+    // Calls on_match(id) for every event with in < end and begin < out. An
+    // empty query, where begin >= end, matches nothing.
+    template<typename OnMatch>
+    void for_each_overlap(ticks_type begin, ticks_type end, OnMatch&& on_match) const {
+        auto const n = _ins.size();
+        if (n == 0 || begin >= end) { return; }
+
+        struct Node {
+            std::size_t index;
+            int level;
+            bool left_done;
+        };
+
+        std::array<Node, 64> stack;
+        std::size_t top = 0;
+        stack[top++] = Node{ (std::size_t{ 1 } << _max_level) - 1, _max_level, false };
+
+        while (top > 0) {
+            auto const node = stack[--top];
+            if (node.level <= LEAF_LEVEL) {
+                // Small subtrees are scanned linearly in sorted order.
+                auto const first = node.index >> node.level << node.level;
+                auto const last = std::min(first + (std::size_t{ 1 } << (node.level + 1)) - 1, n);
+                for (auto i = first; i < last && _ins[i] < end; ++i) {
+                    if (begin < _outs[i]) { on_match(_ids[i]); }
+                }
+            } else if (!node.left_done) {
+                stack[top++] = Node{ node.index, node.level, true };
+                auto const left = node.index - (std::size_t{ 1 } << (node.level - 1));
+                if (left >= n || _max_outs[left] > begin) {
+                    stack[top++] = Node{ left, node.level - 1, false };
+                }
+            } else if (node.index < n && _ins[node.index] < end) {
+                if (begin < _outs[node.index]) { on_match(_ids[node.index]); }
+                stack[top++] = Node{ node.index + (std::size_t{ 1 } << (node.level - 1)), node.level - 1, false };
+            }
+        }
+    }
+
+    // Calls on_match(id) for every event with in <= point < out.
+    template<typename OnMatch>
+    void for_each_covering(ticks_type point, OnMatch&& on_match) const {
+        for_each_overlap(point, point + 1, std::forward<OnMatch>(on_match));
+    }
+
+    // Batch form of for_each_covering(). The ids of the events covering
+    // points[q] are appended to ids, and offsets receives points.size() + 1
+    // entries such that they are ids[offsets[q]] up to ids[offsets[q + 1]].
+    void covering(span_type<ticks_type const> points, std::vector<std::size_t>& offsets, std::vector<std::size_t>& ids) const {
+        offsets.clear();
+        offsets.reserve(points.size() + 1);
+        offsets.push_back(ids.size());
+        for (auto const point : points) {
+            for_each_covering(point, [&ids](std::size_t id) { ids.push_back(id); });
+            offsets.push_back(ids.size());
+        }
+    }
+
+    // Batch form of for_each_overlap() for the ranges [begins[q], ends[q]),
+    // with the same output layout as covering().
+    void overlapping(
+        span_type<ticks_type const> begins,
+        span_type<ticks_type const> ends,
+        std::vector<std::size_t>& offsets,
+        std::vector<std::size_t>& ids
+    ) const {
+        CXXTC_ASSERT(begins.size() == ends.size());
+        offsets.clear();
+        offsets.reserve(begins.size() + 1);
+        offsets.push_back(ids.size());
+        for (std::size_t q = 0; q < begins.size(); ++q) {
+            for_each_overlap(begins[q], ends[q], [&ids](std::size_t id) { ids.push_back(id); });
+            offsets.push_back(ids.size());
+        }
+    }
+
+    inline size_type size() const noexcept { return _ins.size(); }
+    inline bool empty() const noexcept { return _ins.empty(); }
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    static constexpr int LEAF_LEVEL = 3;
+
+    // Fills _max_outs bottom-up. Leaves are the even indices; the node at
+    // level k sits at odd multiples of 2^k - 1. Nodes whose right child is
+    // past the end take the largest out seen so far along the right edge.
+    void build() {
+        auto const n = _ins.size();
+        _max_outs = _outs;
+        _max_level = 0;
+        if (n == 0) { return; }
+
+        std::size_t last_index = 0;
+        ticks_type last_max = 0;
+        for (std::size_t i = 0; i < n; i += 2) {
+            last_index = i;
+            last_max = _max_outs[i];
+        }
+
+        int level = 1;
+        for (; (std::size_t{ 1 } << level) <= n; ++level) {
+            auto const half = std::size_t{ 1 } << (level - 1);
+            auto const first = (half << 1) - 1;
+            auto const step = half << 2;
+            for (auto i = first; i < n; i += step) {
+                auto const left = _max_outs[i - half];
+                auto const right = (i + half < n) ? _max_outs[i + half] : last_max;
+                _max_outs[i] = std::max({ _outs[i], left, right });
+            }
+            last_index = ((last_index >> level) & 1) ? last_index - half : last_index + half;
+            if (last_index < n && _max_outs[last_index] > last_max) {
+                last_max = _max_outs[last_index];
+            }
+        }
+        _max_level = level - 1;
+    }
+
+    fps_variant_type _fps;
+    std::vector<ticks_type> _ins;
+    std::vector<ticks_type> _outs;
+    std::vector<ticks_type> _max_outs;
+    std::vector<std::size_t> _ids;
+    int _max_level = 0;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeRangeSet Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Set of ticks at one frame rate, held as sorted, non-overlapping [begin, end)
+// ranges in two flat arrays. Ranges that touch are always coalesced, so every
+// set has exactly one representation. Union, intersection and difference are
+// linear merges; runs of ranges that end before the other operand's current
+// range are skipped with a vectorized scan for 32-bit ticks.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeRangeSet {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using size_type = std::size_t;
+
+    template<typename T, std::size_t N = std::dynamic_extent>
+    using span_type = std::span<T, N>;
+
+public:
+    TimecodeRangeSet() = delete;
+
+    explicit TimecodeRangeSet(fps_type fps)
+        : _fps(fps.as_variant())
+    {}
+
+    // Set covering every [begins[i], ends[i]), in any order and possibly
+    // overlapping. Empty ranges are ignored.
+    static TimecodeRangeSet from_ranges(fps_type fps, span_type<ticks_type const> begins, span_type<ticks_type const> ends) {
+        if (begins.size() != ends.size()) {
+            CXXTC_THROW(std::format("range set needs as many begins as ends, got {} and {}", begins.size(), ends.size()));
+        }
+
+        std::vector<std::size_t> order;
+        order.reserve(begins.size());
+        for (std::size_t i = 0; i < begins.size(); ++i) {
+            if (begins[i] < ends[i]) { order.push_back(i); }
+        }
+        std::ranges::sort(order, [&](std::size_t lhs, std::size_t rhs) { return begins[lhs] < begins[rhs]; });
+
+        TimecodeRangeSet set{ fps };
+        for (auto const i : order) { set.append(begins[i], ends[i]); }
+        return set;
+    }
+
+    TimecodeRangeSet unite(TimecodeRangeSet const& other) const {
+        check_fps(other);
+        TimecodeRangeSet result{ fps() };
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < size() || j < other.size()) {
+            auto const take_lhs = (j == other.size()) || (i < size() && _begins[i] <= other._begins[j]);
+            if (take_lhs) {
+                result.append(_begins[i], _ends[i]);
+                ++i;
+            } else {
+                result.append(other._begins[j], other._ends[j]);
+                ++j;
+            }
+        }
+        return result;
+    }
+
+    TimecodeRangeSet intersect(TimecodeRangeSet const& other) const {
+        check_fps(other);
+        TimecodeRangeSet result{ fps() };
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < size() && j < other.size()) {
+            if (_ends[i] <= other._begins[j]) {
+                i = skip_ends(_ends, i, other._begins[j]);
+                continue;
+            }
+            if (other._ends[j] <= _begins[i]) {
+                j = skip_ends(other._ends, j, _begins[i]);
+                continue;
+            }
+
+            auto const begin = std::max(_begins[i], other._begins[j]);
+            auto const end = std::min(_ends[i], other._ends[j]);
+            result.append(begin, end);
+            if (_ends[i] < other._ends[j]) { ++i; } else { ++j; }
+        }
+        return result;
+    }
+
+    // Ticks in this set that are not in other.
+    TimecodeRangeSet subtract(TimecodeRangeSet const& other) const {
+        check_fps(other);
+        TimecodeRangeSet result{ fps() };
+        std::size_t j = 0;
+        for (std::size_t i = 0; i < size(); ++i) {
+            auto begin = _begins[i];
+            auto const end = _ends[i];
+            j = skip_ends(other._ends, j, begin);
+            while (j < other.size() && other._begins[j] < end) {
+                if (begin < other._begins[j]) { result.append(begin, other._begins[j]); }
+                begin = std::max(begin, other._ends[j]);
+                if (other._ends[j] >= end) { break; }
+                ++j;
+            }
+            if (begin < end) { result.append(begin, end); }
+        }
+        return result;
+    }
+
+    TimecodeRangeSet operator|(TimecodeRangeSet const& other) const { return unite(other); }
+    TimecodeRangeSet operator&(TimecodeRangeSet const& other) const { return intersect(other); }
+    TimecodeRangeSet operator-(TimecodeRangeSet const& other) const { return subtract(other); }
+
+    bool contains(ticks_type ticks) const noexcept {
+        auto const i = static_cast<std::size_t>(std::ranges::upper_bound(_begins, ticks) - _begins.begin());
+        return i > 0 && ticks < _ends[i - 1];
+    }
+
+    // Total number of ticks covered.
+    ticks_type length() const noexcept {
+        ticks_type total = 0;
+        for (std::size_t i = 0; i < size(); ++i) { total += _ends[i] - _begins[i]; }
+        return total;
+    }
+
+    bool operator==(TimecodeRangeSet const& other) const noexcept {
+        return _fps == other._fps && _begins == other._begins && _ends == other._ends;
+    }
+
+    inline size_type size() const noexcept { return _begins.size(); }
+    inline bool empty() const noexcept { return _begins.empty(); }
+    inline span_type<ticks_type const> begins() const noexcept { return _begins; }
+    inline span_type<ticks_type const> ends() const noexcept { return _ends; }
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    // Appends a range that begins no earlier than the last one, coalescing
+    // it with the last range if they overlap or touch.
+    void append(ticks_type begin, ticks_type end) {
+        if (!_ends.empty() && begin <= _ends.back()) {
+            _ends.back() = std::max(_ends.back(), end);
+            return;
+        }
+        _begins.push_back(begin);
+        _ends.push_back(end);
+    }
+
+    // First index at or after from whose range ends after ticks.
+    static std::size_t skip_ends(std::vector<ticks_type> const& ends, std::size_t from, ticks_type ticks) noexcept {
+        if constexpr (std::same_as<ticks_type, std::uint32_t>) {
+            return __simd::first_greater_epu32(ends.data(), from, ends.size(), ticks);
+        } else {
+            while (from < ends.size() && ends[from] <= ticks) { ++from; }
+            return from;
+        }
+    }
+
+    void check_fps(TimecodeRangeSet const& other) const {
+        if (other._fps != _fps) {
+            CXXTC_THROW(std::format("range set fps value \"{}\" does not match fps value \"{}\"", other.fps().as_underlying(), fps().as_underlying()));
+        }
+    }
+
+    fps_variant_type _fps;
+    std::vector<ticks_type> _begins;
+    std::vector<ticks_type> _ends;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeClock Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// House clock that publishes the current timecode in one atomic word, as a
+// PackedTimecode, so any number of threads can sample it with a single load
+// and no lock. One driver advances it, either from steady_clock with
+// update() (or run() on a thread of its own) or from an external frame pulse
+// with pulse(). The value wraps at 24 hours.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeClock {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using packed_type = PackedTimecode<std::uint64_t, IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using clock_type = std::chrono::steady_clock;
+    using time_point_type = clock_type::time_point;
+
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+public:
+    TimecodeClock() = delete;
+    TimecodeClock(TimecodeClock const&) = delete;
+    TimecodeClock& operator=(TimecodeClock const&) = delete;
+
+    // Starts at start, which update() treats as the timecode at epoch.
+    explicit TimecodeClock(timecode_type const& start, time_point_type epoch = clock_type::now())
+        : _fps(start.fps().as_variant())
+        , _start(start.ticks())
+        , _epoch(epoch)
+        , _word(packed_type::from_basic_unchecked(start).word())
+    {
+        // Ticks per nanosecond, reduced so that the split in ticks_at()
+        // stays within 64 bits.
+        auto numerator = std::uint64_t{ fps_enum_type::template rate_numerator<std::uint64_t>(start.fps()) } * TickRate;
+        auto denominator = std::uint64_t{ fps_enum_type::template rate_denominator<std::uint64_t>(start.fps()) } * 1'000'000'000;
+        auto const divisor = std::gcd(numerator, denominator);
+        _numerator = numerator / divisor;
+        _denominator = denominator / divisor;
+    }
+
+    // Current value; wait-free.
+    timecode_type now() const noexcept {
+        return unpack(_word.load(std::memory_order_acquire));
+    }
+
+    // Publishes the timecode for the steady_clock time at, and wakes
+    // waiters.
+    void update(time_point_type at = clock_type::now()) noexcept {
+        publish(ticks_at(at));
+    }
+
+    // Advances the published value by frames, for clocks driven by an
+    // external pulse at the clock's rate.
+    void pulse(ticks_type frames = 1) noexcept {
+        auto const delta = static_cast<typename timecode_type::offset_type>(frames) * TickRate;
+        publish(timecode_type::offset_ticks(now().ticks(), delta, _fps, OverflowPolicy::WRAP).value());
+    }
+
+    // Blocks until the published value reaches target, which must be at the
+    // clock's rate. A target at or before the value on entry counts as
+    // reached. Progress is measured from that value modulo the day, so a
+    // jump past midnight that skips target still wakes the waiter. Relies on
+    // the driver to keep publishing.
+    void wait_until(timecode_type const& target) const {
+        if (target.fps() != fps()) {
+            CXXTC_THROW(std::format("target fps value \"{}\" does not match clock fps value \"{}\"", target.fps().as_underlying(), fps().as_underlying()));
+        }
+
+        auto word = _word.load(std::memory_order_acquire);
+        auto const entry = static_cast<std::uint64_t>(unpack(word).ticks());
+        if (target.ticks() <= entry) { return; }
+
+        auto const day = static_cast<std::uint64_t>(timecode_type::TICKS_MAX(_fps));
+        auto const distance = target.ticks() - entry;
+        auto const elapsed = [&](std::uint64_t w) { return (unpack(w).ticks() + day - entry) % day; };
+        while (elapsed(word) < distance) {
+            _word.wait(word, std::memory_order_acquire);
+            word = _word.load(std::memory_order_acquire);
+        }
+    }
+
+    // Drives the clock from steady_clock until stop is requested, updating
+    // once per frame at frame boundaries, e.g. on a std::jthread.
+    void run(std::stop_token stop) noexcept {
+        while (!stop.stop_requested()) {
+            auto const at = clock_type::now();
+            update(at);
+            std::this_thread::sleep_until(next_frame_after(at));
+        }
+    }
+
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    ticks_type ticks_at(time_point_type at) const noexcept {
+        auto const elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::max<clock_type::duration>(at - _epoch, clock_type::duration::zero()));
+        auto const nanoseconds = static_cast<std::uint64_t>(elapsed.count());
+        auto const whole = nanoseconds / _denominator;
+        auto const rest = nanoseconds % _denominator;
+        auto const day = static_cast<std::uint64_t>(timecode_type::TICKS_MAX(_fps));
+        return static_cast<ticks_type>((_start + (whole * _numerator) % day + rest * _numerator / _denominator) % day);
+    }
+
+    time_point_type next_frame_after(time_point_type at) const noexcept {
+        auto const ticks = ticks_at(at);
+        auto const to_next = TickRate - ticks % TickRate;
+        auto const nanoseconds = (std::uint64_t{ to_next } * _denominator + _numerator - 1) / _numerator;
+        return at + std::chrono::duration_cast<clock_type::duration>(std::chrono::nanoseconds{ nanoseconds });
+    }
+
+    void publish(ticks_type ticks) noexcept {
+        _word.store(packed_type::from_basic_unchecked(timecode_type::from_ticks_unchecked(ticks, _fps)).word(), std::memory_order_release);
+        _word.notify_all();
+    }
+
+    static timecode_type unpack(std::uint64_t word) noexcept {
+        return packed_type::from_word(word)->to_basic();
+    }
+
+    fps_variant_type _fps;
+    ticks_type _start;
+    time_point_type _epoch;
+    std::uint64_t _numerator = 1;
+    std::uint64_t _denominator = 1;
+    std::atomic<std::uint64_t> _word;
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeTimerWheel Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Hierarchical timer wheel of cues keyed by frame number (ticks / TickRate)
+// over one day at a single frame rate. Four levels of 64 slots cover 2^24
+// frames; a cue sits at the level of the highest 6-bit group in which its
+// frame differs from the current one and cascades down as that group is
+// reached. Cues live in a pooled array of nodes linked into their slot, so
+// schedule() and cancel() are O(1) and allocate only when the pool grows.
+// advance() jumps between occupied slots using per-level bitmaps.
+template<typename Payload, std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeTimerWheel {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using payload_type = Payload;
+
+    static constexpr std::size_t LEVEL_BITS = 6;
+    static constexpr std::size_t LEVEL_SLOTS = std::size_t{ 1 } << LEVEL_BITS;
+    static constexpr std::size_t LEVELS = 4;
+
+    static_assert(std::uint64_t{ 24 } * 60 * 60 * 30 < (std::uint64_t{ 1 } << (LEVEL_BITS * LEVELS)),
+                  "timer wheel must span a full day of frames");
+
+    // Identifies a scheduled cue; stale after the cue fires or is cancelled.
+    struct handle_type {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+public:
+    TimecodeTimerWheel() = delete;
+
+    // Starts the wheel at start, whose frame rate all cues must share.
+    explicit TimecodeTimerWheel(timecode_type const& start)
+        : _fps(start.fps().as_variant())
+        , _frame(frame_of(start.ticks()))
+    {
+        check_within_day(start, "start");
+        _heads.fill(NIL);
+        _tails.fill(NIL);
+    }
+
+    void reserve(std::size_t count) {
+        _nodes.reserve(count);
+    }
+
+    // Schedules payload to fire at due. Cues at or before the current frame
+    // fire on the next call to advance(); cues due on the same frame fire in
+    // the order they were scheduled. Throws if due is past the end of the
+    // day, which the wheel does not span.
+    handle_type schedule(timecode_type const& due, Payload payload) {
+        if (due.fps() != fps()) {
+            CXXTC_THROW(std::format("cue fps value \"{}\" does not match timer wheel fps value \"{}\"", due.fps().as_underlying(), fps().as_underlying()));
+        }
+        check_within_day(due, "cue");
+
+        auto const index = acquire();
+        auto& node = _nodes[index];
+        node.payload.emplace(std::move(payload));
+        node.due = due.ticks();
+        place(index);
+        ++_size;
+        return handle_type{ index, node.generation };
+    }
+
+    // Removes a pending cue; false if it already fired or was cancelled.
+    bool cancel(handle_type handle) noexcept {
+        if (handle.index >= _nodes.size() || _nodes[handle.index].generation != handle.generation || !_nodes[handle.index].payload.has_value()) {
+            return false;
+        }
+
+        unlink(handle.index);
+        release(handle.index);
+        --_size;
+        return true;
+    }
+
+    // Moves the wheel forward to now and calls on_fire(payload, due) for
+    // every cue due at or before it: cues already due first, then the rest
+    // in frame order. The wheel covers a single day, so timecodes before the
+    // current one only fire cues that are already due. on_fire may schedule
+    // and cancel cues, including ones due on the same frame, but must not
+    // call advance(). Returns the number of cues fired.
+    template<typename F>
+    std::size_t advance(timecode_type const& now, F&& on_fire) {
+        check_within_day(now, "current");
+        auto fired = fire_list(DUE_LIST, on_fire);
+        auto const target = frame_of(now.ticks());
+
+        while (_frame < target) {
+            auto const next = std::min(next_event(), target);
+            _frame = next;
+            for (auto level = LEVELS; level-- > 0;) {
+                auto const slot = slot_of(level, _frame);
+                auto const mask = (std::uint64_t{ 1 } << (level * LEVEL_BITS)) - 1;
+                if ((_frame & mask) != 0 || _heads[list_of(level, slot)] == NIL) { continue; }
+                fired += cascade(list_of(level, slot), on_fire);
+            }
+            fired += fire_list(DUE_LIST, on_fire);
+        }
+
+        return fired;
+    }
+
+    timecode_type now() const {
+        return timecode_type::from_ticks_unchecked(static_cast<ticks_type>(_frame * TickRate), _fps);
+    }
+
+    inline std::size_t size() const noexcept { return _size; }
+    inline bool empty() const noexcept { return _size == 0; }
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    static constexpr std::uint32_t NIL = std::numeric_limits<std::uint32_t>::max();
+    static constexpr std::size_t DUE_LIST = LEVELS * LEVEL_SLOTS;
+    static constexpr std::size_t BATCH_LIST = DUE_LIST + 1;
+
+    struct Node {
+        std::optional<Payload> payload;
+        ticks_type due = 0;
+        std::uint32_t prev = NIL;
+        std::uint32_t next = NIL;
+        std::uint32_t list = 0;
+        std::uint32_t generation = 0;
+    };
+
+    static constexpr std::uint64_t frame_of(ticks_type ticks) noexcept {
+        return static_cast<std::uint64_t>(ticks / TickRate);
+    }
+
+    static constexpr std::size_t slot_of(std::size_t level, std::uint64_t frame) noexcept {
+        return static_cast<std::size_t>(frame >> (level * LEVEL_BITS)) & (LEVEL_SLOTS - 1);
+    }
+
+    static constexpr std::size_t list_of(std::size_t level, std::size_t slot) noexcept {
+        return level * LEVEL_SLOTS + slot;
+    }
+
+    static void check_within_day(timecode_type const& tc, char const* what) {
+        if (tc.ticks() > timecode_type::TICKS_MAX(tc.fps())) {
+            CXXTC_THROW(std::format("{} ticks value \"{}\" is past the end of the day the timer wheel spans", what, tc.ticks()));
+        }
+    }
+
+    std::uint32_t acquire() {
+        if (_free != NIL) {
+            auto const index = _free;
+            _free = _nodes[index].next;
+            return index;
+        }
+
+        _nodes.emplace_back();
+        return static_cast<std::uint32_t>(_nodes.size() - 1);
     }
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_hours(T hours, fps_type fps) noexcept {
-        ticks_type const ticks = hours * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE);
-        return BasicTimecode::from_ticks(ticks, fps);
+    void release(std::uint32_t index) noexcept {
+        auto& node = _nodes[index];
+        node.payload.reset();
+        ++node.generation;
+        node.prev = NIL;
+        node.next = _free;
+        _free = index;
     }
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_hours_unchecked(T hours, fps_type fps) {
-        ticks_type const ticks = hours * CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(fps), TICK_RATE); 
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    // Links a node into the due list or the slot for its frame relative to
+    // the current one.
+    void place(std::uint32_t index) noexcept {
+        auto const frame = frame_of(_nodes[index].due);
+        if (frame <= _frame) {
+            link(index, DUE_LIST);
+            return;
+        }
+
+        auto const level = static_cast<std::size_t>(std::bit_width(frame ^ _frame) - 1) / LEVEL_BITS;
+        CXXTC_ASSERT(level < LEVELS);
+        link(index, list_of(level, slot_of(level, frame)));
     }
 
-    template<std::unsigned_integral T>
-    static constexpr std::optional<BasicTimecode> from_hmsf(T hours, T minutes, T seconds, T frames, fps_type fps) noexcept {
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
-        ticks += hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-        ticks += minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-        ticks += seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-        if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-        ticks += frames * CXXTC_1FRAME_TICKS(TICK_RATE); 
-        return BasicTimecode::from_ticks(ticks, fps);
+    // Appends to the tail, so that cues on one frame keep schedule order.
+    void link(std::uint32_t index, std::size_t list) noexcept {
+        auto& node = _nodes[index];
+        node.list = static_cast<std::uint32_t>(list);
+        node.prev = _tails[list];
+        node.next = NIL;
+        if (node.prev != NIL) { _nodes[node.prev].next = index; }
+        else { _heads[list] = index; }
+        _tails[list] = index;
+        if (list < DUE_LIST) { _occupied[list / LEVEL_SLOTS] |= std::uint64_t{ 1 } << (list % LEVEL_SLOTS); }
     }
 
-    template<std::unsigned_integral T>
-    static constexpr BasicTimecode from_hmsf_unchecked(T hours, T minutes, T seconds, T frames, fps_type fps) {
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
-        ticks += (hours * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE)); 
-        ticks += (minutes * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE)); 
-        ticks += (seconds * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE)); 
-        ticks += (frames * CXXTC_1FRAME_TICKS(TICK_RATE)); 
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+    void unlink(std::uint32_t index) noexcept {
+        auto const& node = _nodes[index];
+        if (node.prev != NIL) { _nodes[node.prev].next = node.next; }
+        else { _heads[node.list] = node.next; }
+        if (node.next != NIL) { _nodes[node.next].prev = node.prev; }
+        else { _tails[node.list] = node.prev; }
+        if (node.list < DUE_LIST && _heads[node.list] == NIL) {
+            _occupied[node.list / LEVEL_SLOTS] &= ~(std::uint64_t{ 1 } << (node.list % LEVEL_SLOTS));
+        }
     }
 
-    static constexpr std::optional<BasicTimecode> from_string(string_view_type tc, fps_type fps) noexcept {
-        return BasicTimecode::timecode_to_ticks(tc, fps);
+    // Moves list into the batch list, so that on_fire can reschedule into
+    // it. Batch nodes stay linked until they are taken, so cancelling one
+    // from on_fire unlinks it like any other pending cue.
+    void detach(std::size_t list) noexcept {
+        for (auto index = _heads[list]; index != NIL; index = _nodes[index].next) {
+            _nodes[index].list = static_cast<std::uint32_t>(BATCH_LIST);
+        }
+        _heads[BATCH_LIST] = _heads[list];
+        _tails[BATCH_LIST] = _tails[list];
+        _heads[list] = NIL;
+        _tails[list] = NIL;
+        if (list < DUE_LIST) { _occupied[list / LEVEL_SLOTS] &= ~(std::uint64_t{ 1 } << (list % LEVEL_SLOTS)); }
     }
 
-    static constexpr BasicTimecode from_string_unchecked(string_view_type tc, fps_type fps) {
-        return BasicTimecode::timecode_to_ticks_unchecked(tc, fps);
+    // Unlinks and returns the first node still in the batch, or NIL.
+    std::uint32_t take() noexcept {
+        auto const index = _heads[BATCH_LIST];
+        if (index != NIL) { unlink(index); }
+        return index;
     }
 
-    template<std::unsigned_integral T, std::size_t N>
-        requires (N == 4 || N == 5)
-    static constexpr std::optional<BasicTimecode> from_parts(array_type<T, N> parts, fps_type fps) noexcept {
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+    template<typename F>
+    std::size_t fire_list(std::size_t list, F& on_fire) {
+        auto fired = std::size_t{ 0 };
+        detach(list);
+        for (auto index = take(); index != NIL; index = take()) {
+            fired += fire(index, on_fire);
+        }
+        return fired;
+    }
 
-        if constexpr (N == 4) {
-            auto const [h, m, s, f] = parts;
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-        } else {
-            auto const [h, m, s, f, t] = parts;
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += t;
+    // Re-places every cue in a slot whose group has just been reached; those
+    // due now fire immediately.
+    template<typename F>
+    std::size_t cascade(std::size_t list, F& on_fire) {
+        auto fired = std::size_t{ 0 };
+        detach(list);
+        for (auto index = take(); index != NIL; index = take()) {
+            if (frame_of(_nodes[index].due) <= _frame) { fired += fire(index, on_fire); }
+            else { place(index); }
         }
+        return fired;
+    }
 
-        return BasicTimecode::from_ticks(ticks, fps);
+    template<typename F>
+    std::size_t fire(std::uint32_t index, F& on_fire) {
+        auto payload = std::move(*_nodes[index].payload);
+        auto const due = timecode_type::from_ticks_unchecked(_nodes[index].due, _fps);
+        release(index);
+        --_size;
+        std::invoke(on_fire, std::move(payload), due);
+        return 1;
     }
 
-    template<std::unsigned_integral T>
-    static std::optional<BasicTimecode> from_parts(dynamic_array_type<T> const& parts, fps_type fps) {
-        std::size_t size = parts.size();
-        if (size != 4 || size != 5) { return std::nullopt; }
+    // Earliest frame after the current one at which an occupied slot is
+    // reached. Every occupied slot lies ahead of the current frame's slot
+    // on its level.
+    std::uint64_t next_event() const noexcept {
+        auto next = std::numeric_limits<std::uint64_t>::max();
+        for (auto level = std::size_t{ 0 }; level < LEVELS; ++level) {
+            if (_occupied[level] == 0) { continue; }
+            auto const shift = level * LEVEL_BITS;
+            auto const prefix = (_frame >> (shift + LEVEL_BITS)) << (shift + LEVEL_BITS);
+            auto const slot = static_cast<std::uint64_t>(std::countr_zero(_occupied[level]));
+            next = std::min(next, prefix | (slot << shift));
+        }
+        return next;
+    }
 
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+    fps_variant_type _fps;
+    std::uint64_t _frame;
+    std::size_t _size = 0;
+    std::uint32_t _free = NIL;
+    std::vector<Node> _nodes;
+    std::array<std::uint32_t, BATCH_LIST + 1> _heads;
+    std::array<std::uint32_t, BATCH_LIST + 1> _tails;
+    std::array<std::uint64_t, LEVELS> _occupied{};
+};
 
-        if (size == 4) {
-            auto const h = parts[0];
-            auto const m = parts[1];
-            auto const s = parts[2];
-            auto const f = parts[3];
-
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-        } else {
-            auto const h = parts[0];
-            auto const m = parts[1];
-            auto const s = parts[2];
-            auto const f = parts[3];
-            auto const t = parts[4];
-
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-            if (ticks > TICKS_MAX(fps)) { return std::nullopt; }
-            ticks += t;
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeRange Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Lazy view of the timecodes from start up to, but excluding, end in steps
+// of whole frames. Iterators carry hours, minutes, seconds and frames forward
+// like an odometer, skipping dropped frame labels, so stepping by less than
+// a second never decomposes the ticks; parts() and format_to() on the
+// iterator read the carried parts directly.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeRange : std::ranges::view_interface<TimecodeRange<IntType, TickRate>> {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using parts_type = typename timecode_type::Parts;
+
+    struct iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = timecode_type;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr iterator() noexcept = default;
+
+        constexpr timecode_type operator*() const {
+            return timecode_type::from_ticks_unchecked(_ticks, _fps);
         }
 
-        return BasicTimecode::from_ticks(ticks, fps);
-    }
+        constexpr iterator& operator++() noexcept {
+            if (--_remaining == 0) { return *this; }
+            _ticks += _step * TickRate;
+            if (_step >= _frames_per_second) {
+                _parts = timecode_type::from_ticks_unchecked(_ticks, _fps).parts();
+                return *this;
+            }
 
-    template<std::unsigned_integral T>
-    static BasicTimecode from_parts_unchecked(dynamic_array_type<T> const& parts, fps_type fps) {
-        std::size_t size = parts.size();
-        ticks_type ticks = 0;
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(fps);
+            _parts.frames += _step;
+            while (_parts.frames >= _frames_per_second) {
+                _parts.frames -= _frames_per_second;
+                if (++_parts.seconds < 60) { continue; }
+                _parts.seconds = 0;
+                if (++_parts.minutes == 60) { _parts.minutes = 0; ++_parts.hours; }
+                if (_parts.minutes % 10 != 0) { _parts.frames += _dropped; }
+            }
 
-        if (size == 4) {
-            auto const h = parts[0];
-            auto const m = parts[1];
-            auto const s = parts[2];
-            auto const f = parts[3];
-
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-        } else if (size == 5) {
-            auto const h = parts[0];
-            auto const m = parts[1];
-            auto const s = parts[2];
-            auto const f = parts[3];
-            auto const t = parts[4];
-
-            ticks += h * CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += m * CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += s * CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE); 
-            ticks += f * CXXTC_1FRAME_TICKS(TICK_RATE); 
-            ticks += t;
-        } else {
-            CXXTC_THROW(std::format("timecode parts in dynamically allocated array with size {} could not be parsed: {}", size, parts));
+            return *this;
         }
 
-        return BasicTimecode::from_ticks_unchecked(ticks, fps);
+        constexpr iterator operator++(int) noexcept {
+            auto previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        inline constexpr parts_type const& parts() const noexcept { return _parts; }
+        inline constexpr ticks_type ticks() const noexcept { return _ticks; }
+
+        // As BasicTimecode::format_to(), from the carried parts.
+        constexpr char* format_to(char* out, TimecodeForm form = TimecodeForm::REGULAR) const {
+            auto const [h, m, s, f, t] = _parts;
+            auto const frames_delimiter = fps_enum_type::drop_frame(_fps) ? ';' : ':';
+            return __text::write_timecode(out, h, m, s, f, timecode_type::ticks_to_subframe(t), form == TimecodeForm::EXTENDED, frames_delimiter);
+        }
+
+        friend constexpr bool operator==(iterator const& lhs, iterator const& rhs) noexcept {
+            return lhs._remaining == rhs._remaining;
+        }
+
+    private:
+        friend struct TimecodeRange;
+
+        constexpr iterator(fps_variant_type fps, ticks_type ticks, ticks_type step, std::uint64_t remaining)
+            : _fps(fps)
+            , _ticks(ticks)
+            , _step(step)
+            , _frames_per_second(fps_enum_type::template to_unsigned<ticks_type>(fps))
+            , _dropped(fps_enum_type::template dropped_frames<ticks_type>(fps))
+            , _remaining(remaining)
+            , _parts((remaining != 0) ? timecode_type::from_ticks_unchecked(ticks, fps).parts() : parts_type{})
+        {}
+
+        fps_variant_type _fps{};
+        ticks_type _ticks = 0;
+        ticks_type _step = 1;
+        ticks_type _frames_per_second = 1;
+        ticks_type _dropped = 0;
+        std::uint64_t _remaining = 0;
+        parts_type _parts{};
+    };
+
+public:
+    TimecodeRange() = delete;
+
+    constexpr TimecodeRange(timecode_type const& start, timecode_type const& end, ticks_type step = 1)
+        : _fps(start.fps().as_variant())
+        , _start(start.ticks())
+        , _step(step)
+    {
+        if (start.fps() != end.fps()) {
+            CXXTC_THROW(std::format("range end fps value \"{}\" does not match start fps value \"{}\"", end.fps().as_underlying(), start.fps().as_underlying()));
+        }
+        if (step == 0) {
+            CXXTC_THROW("timecode range step must be at least one frame");
+        }
+
+        auto const span = std::uint64_t{ std::max(end.ticks(), start.ticks()) - start.ticks() };
+        auto const stride = std::uint64_t{ step } * TickRate;
+        _size = (span + stride - 1) / stride;
     }
 
-    template<std::unsigned_integral U = std::uint32_t>
-        requires (std::numeric_limits<U>::max >= std::numeric_limits<ticks_type>::max)
-    inline constexpr U to_unsigned() const noexcept {
-        return _ticks;
+    constexpr iterator begin() const { return iterator{ _fps, _start, _step, _size }; }
+    constexpr iterator end() const noexcept { return iterator{}; }
+    inline constexpr std::size_t size() const noexcept { return static_cast<std::size_t>(_size); }
+
+private:
+    fps_variant_type _fps;
+    ticks_type _start;
+    ticks_type _step;
+    std::uint64_t _size = 0;
+};
+
+// Timecodes from start up to, but excluding, end, every step frames.
+template<std::unsigned_integral IntType, std::uint32_t TickRate>
+constexpr TimecodeRange<IntType, TickRate> timecode_range(
+    BasicTimecode<IntType, TickRate> const& start,
+    BasicTimecode<IntType, TickRate> const& end,
+    typename BasicTimecode<IntType, TickRate>::ticks_type step = 1
+) {
+    return TimecodeRange<IntType, TickRate>{ start, end, step };
+}
+
+} // @END OF namespace __cxxtc
+
+template<std::unsigned_integral IntType, std::uint32_t TickRate>
+inline constexpr bool std::ranges::enable_borrowed_range<__cxxtc::TimecodeRange<IntType, TickRate>> = true;
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION TimecodeLabelGenerator Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+// Burn-in labels for consecutive frames. The generator formats its start
+// once, then keeps an "HH:MM:SS:FF" label and its parts in step frame by
+// frame, rolling frames into seconds, minutes and hours at the frame rate,
+// skipping dropped frame labels and wrapping at 24 hours, and rewriting only
+// the digits that change. fill() copies labels into a caller-supplied ring
+// of fixed-width strings without allocating. Labels are frame-accurate; the
+// start's sub-frame ticks are dropped.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct TimecodeLabelGenerator {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+    using ticks_type = typename timecode_type::ticks_type;
+    using label_type = std::array<char, timecode_type::STRING_SIZE_REGULAR>;
+
+public:
+    TimecodeLabelGenerator() = delete;
+
+    explicit TimecodeLabelGenerator(timecode_type const& start)
+        : _fps(start.fps().as_variant())
+        , _frames_per_second(fps_enum_type::template to_unsigned<std::uint32_t>(start.fps()))
+        , _dropped(fps_enum_type::template dropped_frames<std::uint32_t>(start.fps()))
+        , _ticks(start.ticks() - start.ticks() % TickRate)
+    {
+        auto const [h, m, s, f, t] = start.parts();
+        _hours = static_cast<std::uint32_t>(h);
+        _minutes = static_cast<std::uint32_t>(m);
+        _seconds = static_cast<std::uint32_t>(s);
+        _frames = static_cast<std::uint32_t>(f);
+        __text::write_timecode(_label.data(), h, m, s, f, 0, false, fps_enum_type::drop_frame(start.fps()) ? ';' : ':');
     }
 
-    template<std::signed_integral I = std::int32_t>
-        requires (std::numeric_limits<I>::max >= std::numeric_limits<ticks_type>::max)
-    inline constexpr I to_signed() const noexcept {
-        return _ticks;
+    // Label of the current frame.
+    inline std::string_view label() const noexcept { return std::string_view{ _label.data(), _label.size() }; }
+
+    timecode_type current() const {
+        return timecode_type::from_ticks_unchecked(_ticks, _fps);
     }
 
-    template<std::floating_point F = float>
-    inline constexpr F to_float() const noexcept {
-        return _ticks;
+    // Steps the label to the next frame.
+    void advance() noexcept {
+        _ticks = (_ticks + TickRate == timecode_type::TICKS_MAX(_fps)) ? 0 : _ticks + TickRate;
+        if (++_frames < _frames_per_second) {
+            set_field(FRAMES_OFFSET, _frames - 1, _frames);
+            return;
+        }
+
+        auto const previous_frames = _frames - 1;
+        auto next_frames = std::uint32_t{ 0 };
+        if (++_seconds == 60) {
+            set_field(SECONDS_OFFSET, 59, 0);
+            _seconds = 0;
+            if (++_minutes == 60) {
+                set_field(MINUTES_OFFSET, 59, 0);
+                _minutes = 0;
+                auto const previous_hours = _hours;
+                _hours = (_hours + 1) % CXXTC_HRS_MAX;
+                set_field(HOURS_OFFSET, previous_hours, _hours);
+            }
+            else {
+                set_field(MINUTES_OFFSET, _minutes - 1, _minutes);
+            }
+            if (_minutes % 10 != 0) { next_frames = _dropped; }
+        }
+        else {
+            set_field(SECONDS_OFFSET, _seconds - 1, _seconds);
+        }
+
+        _frames = next_frames;
+        set_field(FRAMES_OFFSET, previous_frames, _frames);
     }
 
-    template<typename S = std::string>
-    S to_string() const {
-        CXXTC_TODO("not implemented");
+    // Writes count consecutive labels into ring, starting at slot from and
+    // wrapping at its end, and leaves the generator on the frame after the
+    // last one written. Returns the slot after the last one written.
+    std::size_t fill(std::span<label_type> ring, std::size_t from, std::size_t count) noexcept {
+        CXXTC_ASSERT(!ring.empty() || count == 0);
+        for (auto i = std::size_t{ 0 }; i < count; ++i) {
+            ring[from] = _label;
+            from = (from + 1 == ring.size()) ? 0 : from + 1;
+            advance();
+        }
+        return from;
     }
 
-    constexpr ticks_type hours_part() const {
-        return _ticks / CXXTC_1HR_TICKS(fps_enum_type::to_unsigned<ticks_type>(_fps), TICK_RATE);
+    // Fills the whole ring in order.
+    void fill(std::span<label_type> ring) noexcept {
+        fill(ring, 0, ring.size());
     }
 
-    constexpr ticks_type minutes_part() const {
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(_fps);
-        auto const reduced = _ticks % CXXTC_1HR_TICKS(fps_unsigned, TICK_RATE);
-        return reduced / CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    static constexpr std::size_t HOURS_OFFSET = 0;
+    static constexpr std::size_t MINUTES_OFFSET = 3;
+    static constexpr std::size_t SECONDS_OFFSET = 6;
+    static constexpr std::size_t FRAMES_OFFSET = 9;
+
+    void set_field(std::size_t offset, std::uint32_t previous, std::uint32_t value) noexcept {
+        if (previous / 10 != value / 10) { _label[offset] = __text::TWO_DIGITS[value * 2]; }
+        _label[offset + 1] = __text::TWO_DIGITS[value * 2 + 1];
     }
 
-    constexpr ticks_type seconds_part() const {
-        auto const fps_unsigned = fps_enum_type::to_unsigned<ticks_type>(_fps);
-        auto const reduced = _ticks % CXXTC_1MIN_TICKS(fps_unsigned, TICK_RATE);
-        return reduced / CXXTC_1SEC_TICKS(fps_unsigned, TICK_RATE);
+    fps_variant_type _fps;
+    std::uint32_t _frames_per_second;
+    std::uint32_t _dropped;
+    ticks_type _ticks;
+    std::uint32_t _hours = 0;
+    std::uint32_t _minutes = 0;
+    std::uint32_t _seconds = 0;
+    std::uint32_t _frames = 0;
+    label_type _label{};
+};
+
+} // @END OF namespace __cxxtc
+
+// -----------------------------------------------------------------------------
+
+
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION LTC Audio Implementation --
+//
+// -----------------------------------------------------------------------------
+
+namespace __cxxtc {
+
+template<typename T>
+concept LtcSample = std::same_as<T, float> || std::same_as<T, std::int16_t>;
+
+// Renders LTC words as biphase mark PCM: the level flips at the start of
+// every bit, and again halfway through a one. Half-bit boundaries fall on
+// the exact sample positions of the frame rate, accumulated over the whole
+// stream, so fractional rates do not drift.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct LtcEncoder {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+
+    static constexpr std::uint64_t HALF_BITS_PER_FRAME = 160;
+
+public:
+    LtcEncoder() = delete;
+
+    // amplitude is the peak level, as a fraction of full scale.
+    LtcEncoder(fps_type fps, std::uint32_t sample_rate, float amplitude = 0.5f)
+        : _fps(fps.as_variant())
+        , _amplitude(amplitude)
+    {
+        // Samples per half bit: sample_rate * denominator / (numerator * 160).
+        auto numerator = std::uint64_t{ sample_rate } * fps_enum_type::template rate_denominator<std::uint64_t>(fps);
+        auto denominator = fps_enum_type::template rate_numerator<std::uint64_t>(fps) * HALF_BITS_PER_FRAME;
+        auto const divisor = std::gcd(numerator, denominator);
+        _numerator = numerator / divisor;
+        _denominator = denominator / divisor;
     }
 
-    constexpr ticks_type frames_part() const {
-        auto const reduced = _ticks % CXXTC_1SEC_TICKS(fps_enum_type::to_unsigned<ticks_type>(_fps), TICK_RATE);
-        return reduced / CXXTC_1FRAME_TICKS(TICK_RATE);
+    // Upper bound on the samples encode() writes for one frame.
+    std::size_t max_frame_samples() const noexcept {
+        return static_cast<std::size_t>((HALF_BITS_PER_FRAME * _numerator + _denominator - 1) / _denominator) + 1;
     }
 
-    constexpr ticks_type ticks_part() const {
-        auto const reduced = _ticks % CXXTC_1FRAME_TICKS(TICK_RATE);
-        return reduced;
+    // Writes one frame of LTC for tc into out, which must hold
+    // max_frame_samples(), and returns the number of samples written.
+    template<LtcSample Sample>
+    std::size_t encode(timecode_type const& tc, std::span<Sample> out, std::uint32_t user_bits = 0) {
+        if (tc.fps() != fps()) {
+            CXXTC_THROW(std::format("timecode fps value \"{}\" does not match encoder fps value \"{}\"", tc.fps().as_underlying(), fps().as_underlying()));
+        }
+        CXXTC_ASSERT(out.size() >= max_frame_samples());
+
+        auto const word = tc.to_ltc(user_bits);
+        auto const high = static_cast<Sample>(std::same_as<Sample, float> ? _amplitude : _amplitude * 32767.0f);
+        auto const low = static_cast<Sample>(-high);
+        std::size_t written = 0;
+
+        for (std::size_t bit = 0; bit < 80; ++bit) {
+            auto const one = (word[bit / 8] >> (bit % 8)) & 1u;
+            for (std::size_t half = 0; half < 2; ++half) {
+                if (half == 0 || one != 0) { _negative = !_negative; }
+                auto const end = static_cast<std::size_t>(++_half_bits * _numerator / _denominator - _samples);
+                std::fill_n(out.data() + written, end, _negative ? low : high);
+                written += end;
+                _samples += end;
+            }
+        }
+
+        return written;
     }
 
-    inline constexpr fps_type fps() const {
-        return _fps;
+    inline fps_type fps() const noexcept { return _fps; }
+
+private:
+    fps_variant_type _fps;
+    float _amplitude;
+    std::uint64_t _numerator = 1;
+    std::uint64_t _denominator = 1;
+    std::uint64_t _half_bits = 0;
+    std::uint64_t _samples = 0;
+    bool _negative = false;
+};
+
+// Streaming LTC decoder for one channel of PCM. Zero crossings are found
+// from per-sample sign masks, 64 samples at a time with the SIMD kernels
+// where available. Each interval between crossings is classed as a whole
+// bit (a zero) or half of one (two make a one) against a running estimate
+// of the bit period, so varispeed playback is tracked. Decoded bits shift
+// through an 80-bit window, and every time the sync word completes it the
+// word is decoded with BasicTimecode::from_ltc(). Samples may arrive in
+// buffers of any size.
+template<std::unsigned_integral IntType = std::uint32_t, std::uint32_t TickRate = CXXTC_TICK_RATE_DEFAULT>
+struct LtcDecoder {
+    using timecode_type = BasicTimecode<IntType, TickRate>;
+    using fps_enum_type = typename timecode_type::fps_enum_type;
+    using fps_variant_type = typename timecode_type::fps_variant_type;
+    using fps_type = typename timecode_type::fps_type;
+
+public:
+    LtcDecoder() = delete;
+
+    LtcDecoder(fps_type fps, std::uint32_t sample_rate)
+        : _fps(fps.as_variant())
+        , _nominal_period(static_cast<std::uint32_t>(
+              std::uint64_t{ sample_rate } * fps_enum_type::template rate_denominator<std::uint64_t>(fps) * PERIOD_SCALE
+              / (fps_enum_type::template rate_numerator<std::uint64_t>(fps) * 80)))
+        , _period(_nominal_period)
+    {}
+
+    // Decodes samples and calls on_frame(tc, user_bits) for every valid
+    // word they complete. Returns the number of words decoded.
+    template<LtcSample Sample, typename F>
+    std::size_t push(std::span<Sample const> samples, F&& on_frame) {
+        std::size_t decoded = 0;
+        for (std::size_t begin = 0; begin < samples.size(); begin += 64) {
+            auto const size = std::min<std::size_t>(64, samples.size() - begin);
+            auto const negative = __simd::negative_mask(samples.data() + begin, size);
+            auto crossings = (negative ^ ((negative << 1) | (_negative ? 1u : 0u)));
+            if (size < 64) { crossings &= (std::uint64_t{ 1 } << size) - 1; }
+            _negative = ((negative >> (size - 1)) & 1u) != 0;
+
+            for (; crossings != 0; crossings &= crossings - 1) {
+                auto const at = _position + static_cast<std::uint64_t>(std::countr_zero(crossings));
+                decoded += interval(at - _last_crossing, on_frame);
+                _last_crossing = at;
+            }
+            _position += size;
+        }
+        return decoded;
     }
 
-    inline constexpr ticks_type ticks() const {
-        return _ticks;
+    template<LtcSample Sample, typename F>
+    std::size_t push(std::span<Sample> samples, F&& on_frame) {
+        return push(std::span<Sample const>{ samples }, std::forward<F>(on_frame));
     }
 
-    inline constexpr flags_type flags() const {
-        return _flags;
+    // Forgets all partial state, e.g. after a discontinuity in the input.
+    void reset() noexcept {
+        _position = 0;
+        _last_crossing = 0;
+        _period = _nominal_period;
+        _negative = false;
+        _half = false;
+        _early = false;
+        _low = 0;
+        _high = 0;
     }
 
+    inline fps_type fps() const noexcept { return _fps; }
+
 private:
-    fps_type _fps;
-    ticks_type _ticks;
-    flags_type _flags;
+    // Bit periods are tracked in sixteenths of a sample.
+    static constexpr std::uint64_t PERIOD_SCALE = 16;
+    static constexpr std::uint64_t SYNC_WORD = (std::uint64_t{ __smpte::LTC_SYNC_HIGH } << 8) | __smpte::LTC_SYNC_LOW;
+
+    template<typename F>
+    std::size_t interval(std::uint64_t samples, F& on_frame) {
+        auto const length = samples * PERIOD_SCALE;
+        if (length < _period / 4 || length > _period * 3 / 2) {
+            _half = false;
+            _early = false;
+            return 0;
+        }
+
+        if (length * 4 >= _period * 3) {
+            _period = static_cast<std::uint32_t>((_period * 7 + length) / 8);
+            _half = false;
+            _early = false;
+            return bit(0, on_frame);
+        }
+
+        // NOTE: The last bit of the sync word is a one, whose second half
+        // only ends at the next frame's first crossing. The first half is
+        // enough to complete the word, so it is decoded without that
+        // latency.
+        _period = static_cast<std::uint32_t>((_period * 7 + length * 2) / 8);
+        _half = !_half;
+        if (_half) {
+            _early = ((_high >> 1) | (std::uint64_t{ 1 } << 15)) == SYNC_WORD;
+            return _early ? bit(1, on_frame) : 0;
+        }
+        return std::exchange(_early, false) ? 0 : bit(1, on_frame);
+    }
+
+    template<typename F>
+    std::size_t bit(std::uint64_t value, F& on_frame) {
+        _low = (_low >> 1) | ((_high & 1u) << 63);
+        _high = (_high >> 1) | (value << 15);
+        if (_high != SYNC_WORD) { return 0; }
+
+        LtcWord word;
+        for (std::size_t i = 0; i < 8; ++i) { word[i] = static_cast<std::uint8_t>(_low >> (8 * i)); }
+        word[8] = __smpte::LTC_SYNC_LOW;
+        word[9] = __smpte::LTC_SYNC_HIGH;
+
+        auto const tc = timecode_type::from_ltc(word, _fps);
+        if (!tc.has_value()) { return 0; }
+        std::invoke(on_frame, *tc, timecode_type::ltc_user_bits(word));
+        return 1;
+    }
+
+    fps_variant_type _fps;
+    std::uint32_t _nominal_period;
+    std::uint32_t _period;
+    std::uint64_t _position = 0;
+    std::uint64_t _last_crossing = 0;
+    bool _negative = false;
+    bool _half = false;
+    bool _early = false;
+    std::uint64_t _low = 0;
+    std::uint64_t _high = 0;
 };
 
 } // @END OF namespace __cxxtc
@@ -595,6 +4649,87 @@ private:
 // -----------------------------------------------------------------------------
 
 
+// -----------------------------------------------------------------------------
+//
+// -- @SECTION Standard Library Specializations --
+//
+// -----------------------------------------------------------------------------
+
+// Format specification for BasicTimecode is "[r|e][;]", where 'r' selects the
+// regular form (default), 'e' the extended form with ticks, and ';' forces the
+// drop-frame separator regardless of the timecode's flags.
+template<std::unsigned_integral IntType, std::uint32_t TickRate>
+struct std::formatter<__cxxtc::BasicTimecode<IntType, TickRate>> {
+    using timecode_type = __cxxtc::BasicTimecode<IntType, TickRate>;
+
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (it != ctx.end() && (*it == 'r' || *it == 'e')) {
+            _extended = (*it == 'e');
+            ++it;
+        }
+
+        if (it != ctx.end() && *it == ';') {
+            _drop_frame_delimiter = true;
+            ++it;
+        }
+
+        if (it != ctx.end() && *it != '}') {
+            throw std::format_error("invalid format specification for timecode");
+        }
+
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(timecode_type const& tc, FormatContext& ctx) const {
+        std::array<char, timecode_type::STRING_SIZE_EXTENDED> buffer;
+        auto const form = (_extended) ? __cxxtc::TimecodeForm::EXTENDED : __cxxtc::TimecodeForm::REGULAR;
+        auto const end = tc.format_to(buffer.data(), form);
+        if (_drop_frame_delimiter) { buffer[CXXTC_FRAMES_BEGIN_INDEX - 1] = ';'; }
+        return std::copy(buffer.data(), end, ctx.out());
+    }
+
+private:
+    bool _extended = false;
+    bool _drop_frame_delimiter = false;
+};
+
+template<__cxxtc::Fps::Variant FPS, std::unsigned_integral IntType, std::uint32_t TickRate>
+struct std::formatter<__cxxtc::StaticTimecode<FPS, IntType, TickRate>> : std::formatter<__cxxtc::BasicTimecode<IntType, TickRate>> {
+    template<typename FormatContext>
+    auto format(__cxxtc::StaticTimecode<FPS, IntType, TickRate> const& tc, FormatContext& ctx) const {
+        return std::formatter<__cxxtc::BasicTimecode<IntType, TickRate>>::format(tc.to_basic(), ctx);
+    }
+};
+
+template<>
+struct std::formatter<__cxxtc::ParseError> {
+    constexpr auto parse(std::format_parse_context& ctx) {
+        auto it = ctx.begin();
+        if (it != ctx.end() && *it != '}') {
+            throw std::format_error("invalid format specification for parse error");
+        }
+        return it;
+    }
+
+    template<typename FormatContext>
+    auto format(__cxxtc::ParseError error, FormatContext& ctx) const {
+        auto const name = __cxxtc::parse_error_name(error);
+        return std::copy(name.begin(), name.end(), ctx.out());
+    }
+};
+
+template<std::unsigned_integral Word, std::unsigned_integral IntType, std::uint32_t TickRate>
+struct std::hash<__cxxtc::PackedTimecode<Word, IntType, TickRate>> {
+    std::size_t operator()(__cxxtc::PackedTimecode<Word, IntType, TickRate> const& tc) const noexcept {
+        return std::hash<Word>{}(tc.word());
+    }
+};
+
+// -----------------------------------------------------------------------------
+
+
 // -----------------------------------------------------------------------------
 //
 // -- @SECTION Clean-Up Macros --
@@ -628,6 +4763,13 @@ private:
 #undef CXXTC_1MIN_TICKS
 #undef CXXTC_1SEC_TICKS
 #undef CXXTC_1FRAME_TICKS
+#undef CXXTC_HAS_AVX2
+#undef CXXTC_HAS_SSE42
+#undef CXXTC_SIMD_DIGITS_REGULAR
+#undef CXXTC_SIMD_DIGITS_EXTENDED
+#undef CXXTC_SIMD_DELIMS_REGULAR
+#undef CXXTC_SIMD_DELIMS_EXTENDED
+#undef CXXTC_HAS_MMAP
 
 // -----------------------------------------------------------------------------
 
@@ -193,4 +193,1113 @@ SUITE("timecode") {
             ASSERT(tc1.ticks() == ticks_sanity_check);
         };
     };
+
+    SECTION("batch conversion from strings") {
+        TEST("batch conversion matches checked conversion") {
+            std::array<std::string_view, 13> const tc_strings = {
+                "00:01:42:12",
+                "00:01:42:12.690",
+                "23:59:59:24",
+                "10:00:00;00",
+                "",
+                "01:02:03.04",
+                "25:02:03:01",
+                "01:72:03:10",
+                "01:02:03:25",
+                "01:2:03:0.0",
+                "de:ad:be:ef",
+                "0a:00:00:00",
+                "01:02:03:04.1x0",
+            };
+
+            std::array<Timecode::ticks_type, tc_strings.size()> ticks = {};
+            std::vector<std::size_t> failed;
+            auto const parsed = Timecode::timecodes_to_ticks(tc_strings, F_25, ticks, failed);
+            ASSERT(parsed == 4);
+            ASSERT(failed.size() == 9);
+            ASSERT(failed.front() == 4);
+
+            bool matches = true;
+            for (std::size_t i = 0; i < tc_strings.size(); ++i) {
+                auto const expected = Timecode::timecode_to_ticks(tc_strings[i], F_25);
+                matches = matches && (ticks[i] == expected.value_or(0));
+            }
+            ASSERT(matches);
+        };
+
+        TEST("batch conversion from packed buffer") {
+            std::string_view const packed = "00:00:01:12\n00:00:05:04\n00:00:99:16\n00:01:00:05\n00:01";
+
+            std::array<Timecode::ticks_type, 5> ticks = {};
+            std::vector<std::size_t> failed;
+            auto const parsed = Timecode::timecodes_to_ticks(packed, 11, 12, F_24, ticks, failed);
+            ASSERT(parsed == 3);
+            ASSERT(failed.size() == 2);
+            ASSERT(failed[0] == 2);
+            ASSERT(failed[1] == 4);
+            ASSERT(ticks[0] == Timecode::timecode_to_ticks("00:00:01:12", F_24).value());
+            ASSERT(ticks[3] == Timecode::timecode_to_ticks("00:01:00:05", F_24).value());
+        };
+    };
+
+    SECTION("conversion to string") {
+        TEST("formatting into caller storage") {
+            Timecode tc1{ "00:01:42:12.690", F_25 };
+
+            std::array<char, Timecode::STRING_SIZE_EXTENDED> buffer = {};
+            auto const end_regular = tc1.format_to(buffer.data());
+            ASSERT(end_regular == buffer.data() + Timecode::STRING_SIZE_REGULAR);
+            ASSERT(std::string_view(buffer.data(), end_regular) == "00:01:42:12");
+
+            auto const end_extended = tc1.format_to(buffer.data(), TimecodeForm::EXTENDED);
+            ASSERT(std::string_view(buffer.data(), end_extended) == "00:01:42:12.690");
+
+            std::string appended = "tc=";
+            tc1.format_to(std::back_inserter(appended));
+            ASSERT(appended == "tc=00:01:42:12");
+        };
+
+        TEST("to_string round trips") {
+            Timecode tc1{ "23:59:59:29.999", F_30 };
+            ASSERT(tc1.to_string() == "23:59:59:29");
+            ASSERT(tc1.to_string(TimecodeForm::EXTENDED) == "23:59:59:29.999");
+
+            Timecode tc2{ "10:00:00;00", F_29P97_DF };
+            ASSERT(tc2.to_string() == "10:00:00;00");
+        };
+
+        TEST("std::format specifications") {
+            Timecode tc1{ "01:02:03:04.005", F_25 };
+            ASSERT(std::format("{}", tc1) == "01:02:03:04");
+            ASSERT(std::format("{:r}", tc1) == "01:02:03:04");
+            ASSERT(std::format("{:e}", tc1) == "01:02:03:04.005");
+            ASSERT(std::format("{:;}", tc1) == "01:02:03;04");
+            ASSERT(std::format("{:e;}", tc1) == "01:02:03;04.005");
+        };
+    };
+
+    SECTION("batch conversion to strings") {
+        TEST("bulk formatting matches single formatting") {
+            std::vector<Timecode::ticks_type> ticks;
+            for (Timecode::ticks_type value = 0; value < Timecode::TICKS_MAX(F_30); value += 7'777'777) {
+                ticks.push_back(value);
+            }
+            ticks.push_back(Timecode::TICKS_MAX(F_30));
+
+            std::string packed(Timecode::formatted_size(ticks.size(), TimecodeForm::EXTENDED, true), '\0');
+            auto const written = Timecode::ticks_to_timecodes(ticks, F_30, packed, TimecodeForm::EXTENDED, true);
+            ASSERT(written == packed.size());
+
+            std::string expected;
+            for (auto const value : ticks) {
+                expected += Timecode::from_ticks(value, F_30).value().to_string(TimecodeForm::EXTENDED);
+                expected += '\n';
+            }
+            ASSERT(packed == expected);
+        };
+
+        TEST("bulk formatting without separators") {
+            std::array<Timecode::ticks_type, 3> const ticks = {
+                Timecode::timecode_to_ticks("00:00:01:12", F_24).value(),
+                Timecode::timecode_to_ticks("10:59:59:23", F_24).value(),
+                Timecode::timecode_to_ticks("24:00:00:00", F_24).value(),
+            };
+
+            std::array<char, 3 * Timecode::STRING_SIZE_REGULAR> packed = {};
+            auto const written = Timecode::ticks_to_timecodes(ticks, F_24, packed);
+            ASSERT(written == packed.size());
+            ASSERT(std::string_view(packed.data(), written) == "00:00:01:1210:59:59:2324:00:00:00");
+        };
+    };
+
+    SECTION("compile-time frame rate") {
+        TEST("static timecode matches runtime timecode") {
+            using Timecode25 = StaticTimecode<F_25>;
+            static_assert(sizeof(Timecode25) == sizeof(Timecode::ticks_type));
+            static_assert(Timecode25::FPS_UNSIGNED == 25);
+            static_assert(Timecode25::TICKS_MAX == Timecode::TICKS_MAX(F_25));
+
+            constexpr auto tc1 = Timecode25::from_hmsf(1u, 2u, 3u, 4u).value();
+            static_assert(tc1.hours_part() == 1 && tc1.minutes_part() == 2);
+            static_assert(tc1.seconds_part() == 3 && tc1.frames_part() == 4);
+
+            Timecode const tc2 = tc1;
+            ASSERT(tc2.fps() == F_25);
+            ASSERT(tc2.ticks() == tc1.ticks());
+            ASSERT(tc2.to_string() == tc1.to_string());
+            ASSERT(std::format("{:e}", tc1) == "01:02:03:04.000");
+
+            Timecode25 const tc3{ "00:01:42:12.690" };
+            Timecode const tc4{ "00:01:42:12.690", F_25 };
+            ASSERT(tc3.ticks() == tc4.ticks());
+            ASSERT(tc3 < tc1);
+        };
+
+        TEST("conversion from runtime timecode checks the rate") {
+            auto const tc1 = Timecode::from_frames(51u, F_25).value();
+            ASSERT(StaticTimecode<F_25>::from_basic(tc1).has_value());
+            ASSERT(!StaticTimecode<F_24>::from_basic(tc1).has_value());
+            ASSERT(!StaticTimecode<F_25>::from_hours(25u).has_value());
+            ASSERT(!StaticTimecode<F_25>::from_string("01:02:03:25").has_value());
+        };
+    };
+
+    SECTION("decomposition into parts") {
+        TEST("parts match part accessors") {
+            Timecode tc1{ "13:01:42:12.690", F_25 };
+            auto const [hrs, mins, secs, frames, ticks] = tc1.parts();
+            ASSERT(hrs == tc1.hours_part());
+            ASSERT(mins == tc1.minutes_part());
+            ASSERT(secs == tc1.seconds_part());
+            ASSERT(frames == tc1.frames_part());
+            ASSERT(ticks == tc1.ticks_part());
+
+            constexpr auto tc2 = Timecode::from_hmsf(23u, 59u, 59u, 29u, F_30).value();
+            static_assert(tc2.parts() == Timecode::Parts{ 23, 59, 59, 29, 0 });
+        };
+
+        TEST("batch decomposition into columns") {
+            std::vector<Timecode::ticks_type> ticks;
+            for (Timecode::ticks_type value = 0; value < Timecode::TICKS_MAX(F_24); value += 9'999'991) {
+                ticks.push_back(value);
+            }
+
+            auto const n = ticks.size();
+            std::vector<Timecode::ticks_type> hrs(n), mins(n), secs(n), frames(n), ticks_parts(n);
+            Timecode::ticks_to_parts(ticks, F_24, hrs, mins, secs, frames, ticks_parts);
+
+            bool matches = true;
+            for (std::size_t i = 0; i < n; ++i) {
+                auto const parts = Timecode::from_ticks(ticks[i], F_24).value().parts();
+                matches = matches && parts == Timecode::Parts{ hrs[i], mins[i], secs[i], frames[i], ticks_parts[i] };
+            }
+            ASSERT(matches);
+        };
+    };
+
+    SECTION("drop-frame") {
+        TEST("drop-frame labels skip frame numbers") {
+            ASSERT(Timecode::timecode_to_ticks("00:00:59;29", F_29P97_DF).value() == 1799 * TICK_RATE);
+            ASSERT(Timecode::timecode_to_ticks("00:01:00;02", F_29P97_DF).value() == 1800 * TICK_RATE);
+            ASSERT(Timecode::timecode_to_ticks("00:10:00;00", F_29P97_DF).value() == 17982 * TICK_RATE);
+            ASSERT(Timecode::timecode_to_ticks("01:00:00;00", F_29P97_DF).value() == 107892 * TICK_RATE);
+            ASSERT(Timecode::timecode_to_ticks("24:00:00;00", F_29P97_DF).value() == Timecode::TICKS_MAX(F_29P97_DF));
+            ASSERT(!Timecode::timecode_to_ticks("00:01:00;00", F_29P97_DF).has_value());
+            ASSERT(!Timecode::timecode_to_ticks("00:01:00;01", F_29P97_DF).has_value());
+            ASSERT(Timecode::timecode_to_ticks("00:10:00;01", F_29P97_DF).has_value());
+            ASSERT(Timecode::timecode_to_ticks("00:01:00;00", F_29P97_NDF).value() == 1800 * TICK_RATE);
+
+            auto const tc1 = Timecode::from_hmsf(0u, 1u, 0u, 2u, F_29P97_DF).value();
+            ASSERT(tc1.ticks() == 1800 * TICK_RATE);
+            ASSERT(!Timecode::from_hmsf(0u, 1u, 0u, 0u, F_29P97_DF).has_value());
+        };
+
+        TEST("drop-frame parts and strings") {
+            auto const tc1 = Timecode::from_frames(1800u, F_29P97_DF).value();
+            ASSERT(tc1.minutes_part() == 1);
+            ASSERT(tc1.seconds_part() == 0);
+            ASSERT(tc1.frames_part() == 2);
+            ASSERT(tc1.to_string() == "00:01:00;02");
+            ASSERT((tc1.parts() == Timecode::Parts{ 0, 1, 0, 2, 0 }));
+
+            auto const tc2 = StaticTimecode<F_29P97_DF>::from_frames(107892u).value();
+            ASSERT(tc2.to_string() == "01:00:00;00");
+            ASSERT(StaticTimecode<F_29P97_DF>::from_hmsf(0u, 1u, 0u, 2u).value().ticks() == tc1.ticks());
+
+            bool round_trips = true;
+            for (std::uint32_t frames = 0; frames < 40'000; ++frames) {
+                auto const tc = Timecode::from_frames(frames, F_29P97_DF).value();
+                round_trips = round_trips && Timecode::timecode_to_ticks(tc.to_string(), F_29P97_DF) == tc.ticks();
+            }
+            ASSERT(round_trips);
+        };
+
+        TEST("drop-frame parts round trip") {
+            ASSERT(Timecode::from_parts(std::array<std::uint32_t, 4>{ 0, 1, 0, 2 }, F_29P97_DF).value().ticks() == 1800 * TICK_RATE);
+            ASSERT(!Timecode::from_parts(std::array<std::uint32_t, 4>{ 0, 1, 0, 0 }, F_29P97_DF).has_value());
+            ASSERT(!Timecode::from_parts(std::array<std::uint32_t, 5>{ 0, 1, 0, 1, 500 }, F_29P97_DF).has_value());
+            ASSERT(!Timecode::from_parts(std::vector<std::uint32_t>{ 0, 1, 0, 0 }, F_29P97_DF).has_value());
+            ASSERT(Timecode::from_parts(std::array<std::uint32_t, 4>{ 24, 0, 0, 0 }, F_29P97_DF).value().ticks() == Timecode::TICKS_MAX(F_29P97_DF));
+
+            bool round_trips = true;
+            for (Timecode::ticks_type ticks = 0; ticks < 40'000 * TICK_RATE; ticks += 7 * TICK_RATE + 123) {
+                auto const tc = Timecode::from_ticks_unchecked(ticks, F_29P97_DF);
+                auto const p = tc.parts();
+                round_trips = round_trips
+                    && Timecode::from_parts(std::array{ p.hours, p.minutes, p.seconds, p.frames, p.ticks }, F_29P97_DF) == tc
+                    && Timecode::from_parts(std::vector{ p.hours, p.minutes, p.seconds, p.frames, p.ticks }, F_29P97_DF) == tc
+                    && Timecode::from_parts_unchecked(std::vector{ p.hours, p.minutes, p.seconds, p.frames, p.ticks }, F_29P97_DF) == tc;
+            }
+            ASSERT(round_trips);
+        };
+
+        TEST("drop-frame batch conversions") {
+            std::vector<Timecode::ticks_type> ticks;
+            for (Timecode::ticks_type frames = 0; frames <= 107'892 * 24; frames += 997) {
+                ticks.push_back(frames * TICK_RATE);
+            }
+
+            std::string packed(Timecode::formatted_size(ticks.size(), TimecodeForm::REGULAR, true), '\0');
+            Timecode::ticks_to_timecodes(ticks, F_29P97_DF, packed, TimecodeForm::REGULAR, true);
+            ASSERT(packed.starts_with("00:00:00;00\n00:00:33;07\n"));
+
+            std::vector<Timecode::ticks_type> parsed(ticks.size());
+            std::vector<std::size_t> failed;
+            Timecode::timecodes_to_ticks(packed, Timecode::STRING_SIZE_REGULAR, Timecode::STRING_SIZE_REGULAR + 1, F_29P97_DF, parsed, failed);
+            ASSERT(failed.empty());
+            ASSERT(parsed == ticks);
+
+            std::array<std::string_view, 2> const dropped = { "00:01:00;00", "00:01:00;02" };
+            std::array<Timecode::ticks_type, 2> dropped_ticks = {};
+            failed.clear();
+            Timecode::timecodes_to_ticks(dropped, F_29P97_DF, dropped_ticks, failed);
+            ASSERT(failed.size() == 1 && failed[0] == 0);
+            ASSERT(dropped_ticks[1] == 1800 * TICK_RATE);
+        };
+    };
+
+    SECTION("columns") {
+        TEST("column stores only ticks at one rate") {
+            using Column = TimecodeColumn<std::uint32_t>;
+            Column column{ F_25 };
+            ASSERT(column.fps() == F_25);
+            ASSERT(column.empty());
+
+            column.push_back(Timecode{ "00:00:01:00", F_25 });
+            std::array<Timecode::ticks_type, 2> const ticks = { 2 * 25 * TICK_RATE, 3 * 25 * TICK_RATE };
+            column.append(ticks);
+            ASSERT(column.size() == 3);
+            ASSERT(column.ticks().size_bytes() == 3 * sizeof(Timecode::ticks_type));
+            ASSERT(column[2].seconds_part() == 3);
+            ASSERT(column[2].fps() == F_25);
+
+            std::size_t seconds = 0;
+            for (auto const tc : column) { seconds += tc.seconds_part(); }
+            ASSERT(seconds == 6);
+            ASSERT(std::ranges::distance(column) == 3);
+        };
+
+        TEST("column bulk parse and format") {
+            TimecodeColumn<std::uint32_t> column{ F_29P97_DF };
+            std::array<std::string_view, 4> const tc_strings = { "00:00:00;00", "00:01:00;00", "00:01:00;02", "xx:01:00;02" };
+            std::vector<std::size_t> failed;
+            ASSERT(column.parse(tc_strings, failed) == 2);
+            ASSERT(column.size() == 2);
+            ASSERT(failed.size() == 2 && failed[0] == 1 && failed[1] == 3);
+            ASSERT(column[1].ticks() == 1800 * TICK_RATE);
+
+            std::string packed(column.formatted_size(TimecodeForm::REGULAR, true), '\0');
+            column.format(packed, TimecodeForm::REGULAR, true);
+            ASSERT(packed == "00:00:00;00\n00:01:00;02\n");
+        };
+
+        TEST("column loads newline-delimited text in parallel chunks") {
+            std::string text;
+            for (std::uint32_t i = 0; i < 1000; ++i) {
+                text += (i % 97 == 5) ? "bad" : Timecode::from_ticks_unchecked(i * TICK_RATE, F_24).to_string();
+                text += (i % 2 == 0) ? "\n" : "\r\n";
+            }
+            text.pop_back();
+
+            std::vector<std::size_t> rejected;
+            auto const column = TimecodeColumn<std::uint32_t>::from_lines(text, F_24, rejected, 4, 256);
+            ASSERT(rejected.size() == 11);
+            ASSERT(rejected[0] == 6 && rejected[1] == 103);
+            ASSERT(column.size() == 989);
+            ASSERT(column[0].ticks() == 0);
+            ASSERT(column[5].ticks() == 6 * TICK_RATE);
+            ASSERT(column[988].ticks() == 999 * TICK_RATE);
+
+            std::vector<std::size_t> rejected_serial;
+            auto const serial = TimecodeColumn<std::uint32_t>::from_lines(text, F_24, rejected_serial, 1);
+            ASSERT(std::ranges::equal(serial.ticks(), column.ticks()));
+            ASSERT(rejected_serial == rejected);
+        };
+    };
+
+    SECTION("streaming") {
+        TEST("push parser resumes across arbitrary chunk boundaries") {
+            std::string_view const stream = "00:00:01:00\r\n00:00:02:00.500\n00:00:0x:00\n00:00:03:00:00:00\n00:00:04:00";
+            std::array<std::optional<Timecode::ticks_type>, 5> const expected = {
+                25 * TICK_RATE, 50 * TICK_RATE + 500, std::nullopt, std::nullopt, 100 * TICK_RATE,
+            };
+
+            for (std::size_t chunk_size = 1; chunk_size <= stream.size(); ++chunk_size) {
+                TimecodeStreamParser<std::uint32_t> parser{ F_25 };
+                std::array<std::optional<Timecode::ticks_type>, 5> records = {};
+                auto const on_record = [&records](std::size_t record, std::optional<Timecode::ticks_type> ticks) {
+                    records[record] = ticks;
+                };
+
+                for (std::size_t offset = 0; offset < stream.size(); offset += chunk_size) {
+                    parser.push(stream.substr(offset, chunk_size), on_record);
+                }
+                ASSERT(parser.records() == 4);
+                ASSERT(parser.pending());
+                parser.finish(on_record);
+                ASSERT(records == expected);
+            }
+        };
+    };
+
+    SECTION("arithmetic") {
+        TEST("timecode arithmetic applies the overflow policy") {
+            auto const one_hour = Timecode::from_hours_unchecked(1u, F_25);
+            auto const twenty_three_hours = Timecode::from_hours_unchecked(23u, F_25);
+            auto const day = Timecode::TICKS_MAX(F_25);
+
+            ASSERT((one_hour + one_hour).hours_part() == 2);
+            ASSERT((twenty_three_hours - one_hour).hours_part() == 22);
+            ASSERT(!twenty_three_hours.add(twenty_three_hours).has_value());
+            ASSERT(twenty_three_hours.add(twenty_three_hours, OverflowPolicy::WRAP)->hours_part() == 22);
+            ASSERT(twenty_three_hours.add(twenty_three_hours, OverflowPolicy::SATURATE)->ticks() == day);
+            ASSERT(one_hour.subtract(twenty_three_hours, OverflowPolicy::WRAP)->hours_part() == 2);
+            ASSERT(one_hour.subtract(twenty_three_hours, OverflowPolicy::SATURATE)->ticks() == 0);
+            ASSERT(!one_hour.add(Timecode::from_hours_unchecked(1u, F_24)).has_value());
+            ASSERT(Timecode::offset_ticks(0u, -1, F_25, OverflowPolicy::WRAP) == day - 1);
+
+            auto sum = one_hour;
+            sum += one_hour;
+            ASSERT(sum.hours_part() == 2);
+        };
+
+        TEST("column rebase reports overflow under every policy") {
+            std::array<Timecode::ticks_type, 3> const ticks = {
+                Timecode::from_hours_unchecked(10u, F_24).ticks(),
+                Timecode::from_hours_unchecked(12u, F_24).ticks(),
+                Timecode::from_hours_unchecked(8u, F_24).ticks(),
+            };
+            auto const from = Timecode::from_hours_unchecked(10u, F_24);
+            auto const to = Timecode::from_hours_unchecked(1u, F_24);
+
+            TimecodeColumn<std::uint32_t> report{ F_24, ticks };
+            std::vector<std::size_t> overflowed;
+            ASSERT(report.rebase(from, to, OverflowPolicy::REPORT, overflowed) == 1);
+            ASSERT(overflowed.size() == 1 && overflowed[0] == 2);
+            ASSERT(report[0].hours_part() == 1 && report[1].hours_part() == 3 && report[2].hours_part() == 8);
+
+            TimecodeColumn<std::uint32_t> wrap{ F_24, ticks };
+            overflowed.clear();
+            ASSERT(wrap.rebase(from, to, OverflowPolicy::WRAP, overflowed) == 1);
+            ASSERT(wrap[2].hours_part() == 23);
+
+            TimecodeColumn<std::uint32_t> saturate{ F_24, ticks };
+            overflowed.clear();
+            ASSERT(saturate.rebase(from, to, OverflowPolicy::SATURATE, overflowed) == 1);
+            ASSERT(saturate[2].ticks() == 0);
+
+            std::vector<Timecode::ticks_type> many(1000, ticks[2]);
+            overflowed.clear();
+            ASSERT(Timecode::offset_ticks(many, -static_cast<Timecode::offset_type>(from.ticks()), F_24, many, OverflowPolicy::REPORT, overflowed) == 1000);
+            ASSERT(overflowed.size() == 1000 && overflowed[999] == 999);
+            ASSERT(many.front() == ticks[2] && many.back() == ticks[2]);
+        };
+    };
+
+    SECTION("rate conversion") {
+        TEST("conversion uses exact rates and snaps to frames") {
+            auto const one_hour = Timecode{ "01:00:00;00", F_29P97_DF };
+            auto const converted = one_hour.convert(F_25);
+            ASSERT(converted.has_value());
+            ASSERT(converted->to_string() == "01:00:00:00");
+            ASSERT(converted->convert(F_29P97_DF)->ticks() == one_hour.ticks());
+
+            auto const pulled_down = Timecode::from_hours_unchecked(1u, F_23P976_NDF);
+            ASSERT(pulled_down.convert(F_29P97_DF)->ticks() == 108000 * TICK_RATE);
+
+            ASSERT(Timecode::convert_ticks(1 * TICK_RATE, F_25, F_24, SnapMode::FLOOR) == 0);
+            ASSERT(Timecode::convert_ticks(1 * TICK_RATE, F_25, F_24, SnapMode::NEAREST) == 1 * TICK_RATE);
+            ASSERT(Timecode::convert_ticks(24 * TICK_RATE, F_24, F_23P976_NDF, SnapMode::FLOOR) == 23 * TICK_RATE);
+            ASSERT(Timecode::convert_ticks(24 * TICK_RATE, F_24, F_23P976_NDF, SnapMode::CEIL) == 24 * TICK_RATE);
+            ASSERT(!Timecode::convert_ticks(Timecode::TICKS_MAX(F_23P976_NDF), F_23P976_NDF, F_25).has_value());
+        };
+
+        TEST("column conversion changes the column rate") {
+            std::array<Timecode::ticks_type, 2> const ticks = { 24 * TICK_RATE, Timecode::TICKS_MAX(F_23P976_NDF) };
+            TimecodeColumn<std::uint32_t> column{ F_23P976_NDF, ticks };
+            std::vector<std::size_t> overflowed;
+            ASSERT(column.convert(F_24, SnapMode::NEAREST, OverflowPolicy::SATURATE, overflowed) == 1);
+            ASSERT(column.fps() == F_24);
+            ASSERT(column[0].ticks() == 24 * TICK_RATE);
+            ASSERT(column[1].ticks() == Timecode::TICKS_MAX(F_24));
+            ASSERT(overflowed.size() == 1 && overflowed[0] == 1);
+        };
+
+        TEST("column conversion drops reported overflows") {
+            std::array<Timecode::ticks_type, 4> const ticks = {
+                Timecode::TICKS_MAX(F_23P976_NDF), 24 * TICK_RATE, Timecode::TICKS_MAX(F_23P976_NDF), 48 * TICK_RATE
+            };
+            TimecodeColumn<std::uint32_t> column{ F_23P976_NDF, ticks };
+            std::vector<std::size_t> overflowed;
+            ASSERT(column.convert(F_24, SnapMode::NEAREST, OverflowPolicy::REPORT, overflowed) == 2);
+            ASSERT((overflowed == std::vector<std::size_t>{ 0, 2 }));
+            ASSERT(column.fps() == F_24);
+            ASSERT(column.size() == 2);
+            ASSERT(column[0].ticks() == 24 * TICK_RATE);
+            ASSERT(column[1].ticks() == 48 * TICK_RATE);
+        };
+    };
+
+    SECTION("comparison") {
+        TEST("timecodes compare exactly across rates") {
+            auto const one_second_24 = Timecode{ "00:00:01:00", F_24 };
+            auto const one_second_25 = Timecode{ "00:00:01:00", F_25 };
+            auto const one_second_23p976 = Timecode{ "00:00:01:00", F_23P976_NDF };
+            ASSERT(one_second_24 == one_second_25);
+            ASSERT(one_second_24 < one_second_23p976);
+            ASSERT((Timecode{ "00:00:00:24", F_25 } < one_second_24));
+            ASSERT((Timecode{ "00:00:01:01", F_25 } > one_second_24));
+            ASSERT((Timecode{ "01:00:03;18", F_29P97_DF } == Timecode{ "01:00:00:00", F_23P976_NDF }));
+
+            using WideTimecode = BasicTimecode<std::uint64_t>;
+            ASSERT(WideTimecode::from_ticks_unchecked(1ull << 40, F_23P976_NDF) > WideTimecode::from_ticks_unchecked(1ull << 40, F_24));
+        };
+
+        TEST("merge-join matches equal instants across rates") {
+            TimecodeColumn<std::uint32_t> camera{ F_24 };
+            TimecodeColumn<std::uint32_t> audio{ F_30 };
+            for (std::uint32_t frame = 0; frame < 240; frame += 3) { camera.push_back(frame * TICK_RATE); }
+            for (std::uint32_t frame = 0; frame < 300; frame += 2) { audio.push_back(frame * TICK_RATE); }
+            audio.push_back(300 * TICK_RATE);
+            camera.push_back(240 * TICK_RATE);
+            camera.push_back(240 * TICK_RATE);
+
+            std::vector<std::pair<std::size_t, std::size_t>> matches;
+            camera.merge_join(audio, [&matches](std::size_t i, std::size_t j) { matches.emplace_back(i, j); });
+
+            // Both sides land on every whole second: camera index 8k, audio index 15k.
+            ASSERT(matches.size() == 10 + 2);
+            ASSERT(matches[1].first == 8 && matches[1].second == 15);
+            ASSERT(camera[matches[5].first] == audio[matches[5].second]);
+            ASSERT(matches[10].first == 80 && matches[11].first == 81 && matches[11].second == 150);
+        };
+    };
+
+    SECTION("interval index") {
+        TEST("index answers point and overlap queries") {
+            auto const at = [](char const* tc) { return Timecode::timecode_to_ticks(tc, F_25).value(); };
+            std::array<Timecode::ticks_type, 4> const ins = { at("00:00:10:00"), at("00:00:00:00"), at("00:00:05:00"), at("00:00:20:00") };
+            std::array<Timecode::ticks_type, 4> const outs = { at("00:00:20:00"), at("00:00:05:00"), at("00:00:15:00"), at("00:00:20:00") };
+            TimecodeIntervalIndex<std::uint32_t> const index{ F_25, ins, outs };
+            ASSERT(index.size() == 3);
+
+            std::vector<std::size_t> hits;
+            index.for_each_covering(at("00:00:12:00"), [&hits](std::size_t id) { hits.push_back(id); });
+            std::ranges::sort(hits);
+            ASSERT(hits.size() == 2 && hits[0] == 0 && hits[1] == 2);
+
+            std::array<Timecode::ticks_type, 3> const points = { at("00:00:05:00"), at("00:00:20:00"), at("00:00:04:24") };
+            std::vector<std::size_t> offsets;
+            std::vector<std::size_t> ids;
+            index.covering(points, offsets, ids);
+            ASSERT(offsets.size() == 4);
+            ASSERT(offsets[1] - offsets[0] == 1 && ids[offsets[0]] == 2);
+            ASSERT(offsets[2] - offsets[1] == 0);
+            ASSERT(offsets[3] - offsets[2] == 1 && ids[offsets[2]] == 1);
+
+            std::array<Timecode::ticks_type, 1> const begins = { at("00:00:04:00") };
+            std::array<Timecode::ticks_type, 1> const ends = { at("00:00:10:00") };
+            ids.clear();
+            index.overlapping(begins, ends, offsets, ids);
+            ASSERT(ids.size() == 2);
+        };
+
+        TEST("index matches a linear scan on random events") {
+            auto state = std::uint64_t{ 0x9e3779b97f4a7c15 };
+            auto const next = [&state](std::uint32_t bound) {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                return static_cast<std::uint32_t>(state % bound);
+            };
+
+            auto const span = 60u * 60u * 25u * TICK_RATE;
+            std::vector<Timecode::ticks_type> ins(3000);
+            std::vector<Timecode::ticks_type> outs(ins.size());
+            for (std::size_t i = 0; i < ins.size(); ++i) {
+                ins[i] = next(span);
+                auto const length = (i % 7 == 0) ? next(span / 4) : next(200 * TICK_RATE);
+                outs[i] = (i % 97 == 0) ? ins[i] : std::min(ins[i] + length, span);
+            }
+            TimecodeIntervalIndex<std::uint32_t> const index{ F_25, ins, outs };
+
+            auto const scan = [&](Timecode::ticks_type begin, Timecode::ticks_type end) {
+                std::vector<std::size_t> expected;
+                for (std::size_t i = 0; i < ins.size(); ++i) {
+                    if (begin < end && ins[i] < outs[i] && ins[i] < end && begin < outs[i]) { expected.push_back(i); }
+                }
+                return expected;
+            };
+
+            bool overlaps_match = true;
+            std::vector<Timecode::ticks_type> points;
+            for (std::size_t q = 0; q < 500; ++q) {
+                auto const begin = next(span + 100 * TICK_RATE);
+                auto const end = (q % 10 == 0) ? begin - std::min(begin, next(TICK_RATE)) : begin + next(300 * TICK_RATE);
+                std::vector<std::size_t> found;
+                index.for_each_overlap(begin, end, [&found](std::size_t id) { found.push_back(id); });
+                std::ranges::sort(found);
+                overlaps_match = overlaps_match && found == scan(begin, end);
+                points.push_back(begin);
+            }
+            ASSERT(overlaps_match);
+
+            std::vector<std::size_t> offsets;
+            std::vector<std::size_t> ids;
+            index.covering(points, offsets, ids);
+            bool points_match = offsets.size() == points.size() + 1;
+            for (std::size_t q = 0; points_match && q < points.size(); ++q) {
+                std::vector<std::size_t> found(ids.begin() + offsets[q], ids.begin() + offsets[q + 1]);
+                std::ranges::sort(found);
+                points_match = found == scan(points[q], points[q] + 1);
+            }
+            ASSERT(points_match);
+        };
+    };
+
+    SECTION("range sets") {
+        TEST("range sets coalesce and support set algebra") {
+            using RangeSet = TimecodeRangeSet<std::uint32_t>;
+            std::array<Timecode::ticks_type, 4> const covered_begins = { 30, 0, 10, 50 };
+            std::array<Timecode::ticks_type, 4> const covered_ends = { 40, 10, 20, 50 };
+            auto const covered = RangeSet::from_ranges(F_25, covered_begins, covered_ends);
+            ASSERT(covered.size() == 2);
+            ASSERT(covered.begins()[0] == 0 && covered.ends()[0] == 20);
+            ASSERT(covered.length() == 30);
+
+            std::array<Timecode::ticks_type, 2> const flagged_begins = { 5, 35 };
+            std::array<Timecode::ticks_type, 2> const flagged_ends = { 8, 60 };
+            auto const flagged = RangeSet::from_ranges(F_25, flagged_begins, flagged_ends);
+
+            auto const clean = covered - flagged;
+            ASSERT(clean.size() == 3);
+            ASSERT(clean.length() == 22);
+            ASSERT(clean.contains(8) && !clean.contains(5) && !clean.contains(35));
+
+            auto const both = covered & flagged;
+            ASSERT(both.length() == 8);
+            ASSERT(((clean | both) == covered));
+            ASSERT((covered | flagged).size() == 2);
+        };
+    };
+
+    SECTION("literals") {
+        TEST("timecode literals are parsed at compile time") {
+            using namespace __cxxtc::literals;
+            constexpr auto tc = "01:00:00;00"_tc2997df;
+            static_assert(std::same_as<decltype(tc), StaticTimecode<F_29P97_DF> const>);
+            static_assert(tc.ticks() == 107892 * TICK_RATE);
+            static_assert(tc.to_string() == "01:00:00;00");
+            static_assert(("00:00:01:12.500"_tc25).parts() == Timecode::Parts{ 0, 0, 1, 12, 500 });
+            static_assert("00:00:01:00"_tc24 == "00:00:01:00"_tc24);
+            ASSERT(("10:00:00:00"_tc25).hours_part() == 10);
+        };
+
+        TEST("tables can be generated at compile time") {
+            using Timecode2997 = StaticTimecode<F_29P97_DF>;
+            static constexpr auto second_starts = [] {
+                std::array<Timecode::ticks_type, 60> starts = {};
+                for (std::uint32_t second = 0; second < 60; ++second) {
+                    auto const first_frame = (second == 0) ? 2u : 0u;
+                    starts[second] = Timecode2997::from_hmsf(0u, 1u, second, first_frame)->ticks();
+                }
+                return starts;
+            }();
+            static_assert(second_starts[0] == 1800 * TICK_RATE);
+            static_assert(second_starts[1] == 1828 * TICK_RATE);
+            static_assert(!Timecode2997::from_hmsf(0u, 1u, 0u, 0u).has_value());
+            ASSERT(second_starts[59] == (1798 + 59 * 30) * TICK_RATE);
+        };
+    };
+
+    SECTION("tick rates") {
+        TEST("audio sample tick rates") {
+            using SampleTimecode = BasicTimecode<std::uint64_t, TickRates::SAMPLES_48K>;
+            static_assert(SampleTimecode::TICK_RATE == 48000);
+            auto const tc = SampleTimecode{ "01:00:00:01.500", F_25 };
+            ASSERT(tc.ticks() == (90001ull * 48000) + 24000);
+            ASSERT(tc.ticks_part() == 24000);
+            ASSERT(tc.to_string(TimecodeForm::EXTENDED) == "01:00:00:01.500");
+            ASSERT((tc.parts() == SampleTimecode::Parts{ 1, 0, 0, 1, 24000 }));
+
+            // One 48 kHz sample at 25 fps is 25 ticks.
+            auto const next_sample = SampleTimecode::from_ticks_unchecked(tc.ticks() + 25, F_25);
+            ASSERT(next_sample.ticks_part() == 24025);
+        };
+
+        TEST("power-of-two tick rates") {
+            using Pow2Timecode = BasicTimecode<std::uint32_t, TickRates::POW2_1024>;
+            auto const tc = Pow2Timecode{ "23:59:59;29.999", F_29P97_DF };
+            ASSERT(tc.ticks_part() == 1023);
+            ASSERT(tc.to_string(TimecodeForm::EXTENDED) == "23:59:59;29.999");
+            ASSERT((tc.parts() == Pow2Timecode::Parts{ 23, 59, 59, 29, 1023 }));
+            ASSERT(std::ranges::all_of(std::views::iota(0u, 1000u), [](std::uint32_t thousandths) {
+                return Pow2Timecode::ticks_to_subframe(Pow2Timecode::subframe_to_ticks(thousandths)) == thousandths;
+            }));
+
+            std::array<Pow2Timecode::ticks_type, 9> ticks = {};
+            for (std::size_t i = 0; i < ticks.size(); ++i) { ticks[i] = static_cast<std::uint32_t>(i * 123456789u) % Pow2Timecode::TICKS_MAX(F_29P97_DF); }
+            std::string bulk(Pow2Timecode::formatted_size(ticks.size(), TimecodeForm::EXTENDED), '\0');
+            Pow2Timecode::ticks_to_timecodes(ticks, F_29P97_DF, bulk, TimecodeForm::EXTENDED);
+            ASSERT(bulk.substr(8 * 15) == Pow2Timecode::from_ticks_unchecked(ticks[8], F_29P97_DF).to_string(TimecodeForm::EXTENDED));
+            ASSERT(bulk.substr(0, 15) == Pow2Timecode::from_ticks_unchecked(ticks[0], F_29P97_DF).to_string(TimecodeForm::EXTENDED));
+        };
+    };
+
+    SECTION("packed timecodes") {
+        TEST("packed timecodes are single words") {
+            using Packed = PackedTimecode<std::uint64_t>;
+            static_assert(sizeof(Packed) == sizeof(std::uint64_t));
+            static_assert(std::is_trivially_copyable_v<Packed>);
+
+            auto const tc = Timecode{ "01:00:00;02", F_29P97_DF };
+            auto const packed = Packed::from_basic(tc);
+            ASSERT(packed.has_value());
+            ASSERT(packed->drop_frame_bit());
+            ASSERT(packed->fps() == F_29P97_DF);
+            ASSERT(packed->to_basic().to_string() == "01:00:00;02");
+            ASSERT(Packed::from_word(packed->word()) == packed);
+            ASSERT(!Packed::from_word(packed->word() | (std::uint64_t{ 7 } << 61)).has_value());
+
+            auto const past_day = Packed::from_basic(Timecode::from_ticks_unchecked(Timecode::TICKS_MAX(F_29P97_DF) + TICK_RATE, F_29P97_DF));
+            ASSERT(past_day.has_value());
+            ASSERT(Packed::from_word(past_day->word()) == past_day);
+
+            auto const earlier = Packed::from_basic_unchecked(Timecode{ "00:59:59;29", F_29P97_DF });
+            auto const other_rate = Packed::from_basic_unchecked(Timecode{ "00:00:00:00", F_30 });
+            ASSERT(earlier < *packed);
+            ASSERT(*packed < other_rate);
+            ASSERT(std::hash<Packed>{}(earlier) == std::hash<std::uint64_t>{}(earlier.word()));
+        };
+
+        TEST("32-bit packing for frame-accurate timecodes") {
+            using FrameTimecode = BasicTimecode<std::uint32_t, 1>;
+            using Packed = PackedTimecode<std::uint32_t, std::uint32_t, 1>;
+            static_assert(sizeof(Packed) == sizeof(std::uint32_t));
+
+            auto const tc = FrameTimecode{ "23:59:59:24", F_25 };
+            auto const packed = Packed::from_basic_unchecked(tc);
+            ASSERT(packed.ticks() == tc.ticks());
+            ASSERT(packed.to_basic().to_string() == "23:59:59:24");
+        };
+    };
+
+    SECTION("clocks") {
+        TEST("external pulse advances and wraps") {
+            auto clock = TimecodeClock<>{ Timecode{ "23:59:59:23", F_24 } };
+            ASSERT(clock.now().to_string() == "23:59:59:23");
+
+            clock.pulse();
+            ASSERT(clock.now().to_string() == "00:00:00:00");
+
+            clock.pulse(48);
+            ASSERT(clock.now().to_string() == "00:00:02:00");
+        };
+
+        TEST("steady clock time maps to exact frames") {
+            using namespace std::chrono_literals;
+            auto const epoch = std::chrono::steady_clock::time_point{};
+            auto clock = TimecodeClock<>{ Timecode{ "01:00:00;00", F_29P97_DF }, epoch };
+
+            clock.update(epoch + 1001ms);
+            ASSERT(clock.now().to_string() == "01:00:01;00");
+
+            clock.update(epoch + 60060ms);
+            ASSERT(clock.now().to_string() == "01:01:00;02");
+
+            clock.update(epoch + 50050us);
+            ASSERT(clock.now().to_string(TimecodeForm::EXTENDED) == "01:00:00;01.500");
+        };
+
+        TEST("waiters wake when the target is published") {
+            auto clock = TimecodeClock<>{ Timecode{ "00:00:00:00", F_25 } };
+            auto const target = Timecode{ "00:00:01:00", F_25 };
+
+            auto driver = std::jthread{ [&clock] {
+                for (auto frame = 0; frame < 25; ++frame) { clock.pulse(); }
+            } };
+
+            clock.wait_until(target);
+            ASSERT(clock.now() >= target);
+        };
+
+        TEST("waiters wake when the clock wraps past the target") {
+            auto clock = TimecodeClock<>{ Timecode{ "23:59:59:20", F_25 } };
+            auto const target = Timecode{ "23:59:59:23", F_25 };
+            auto woke = std::atomic<bool>{ false };
+            auto went_round = false;
+
+            {
+                auto driver = std::jthread{ [&] {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{ 20 });
+                    clock.pulse(5);
+                    std::this_thread::sleep_for(std::chrono::milliseconds{ 500 });
+                    if (!woke.load()) {
+                        // Brings a waiter that missed the wrap to target a day later.
+                        went_round = true;
+                        clock.pulse(Timecode::TICKS_MAX(F_25) / TICK_RATE - 2);
+                    }
+                } };
+
+                clock.wait_until(target);
+                woke.store(true);
+            }
+
+            ASSERT(!went_round);
+            ASSERT(clock.now().to_string() == "00:00:00:00");
+        };
+    };
+
+    SECTION("timer wheels") {
+        TEST("cues fire in frame order up to the current timecode") {
+            auto wheel = TimecodeTimerWheel<int>{ Timecode{ "10:00:00:00", F_25 } };
+            wheel.schedule(Timecode{ "10:00:00:03", F_25 }, 3);
+            wheel.schedule(Timecode{ "10:00:00:01", F_25 }, 1);
+            wheel.schedule(Timecode{ "11:30:00:00", F_25 }, 4);
+            wheel.schedule(Timecode{ "10:00:00:02", F_25 }, 2);
+            ASSERT(wheel.size() == 4);
+
+            auto fired = std::vector<int>{};
+            auto const on_fire = [&fired](int cue, Timecode const&) { fired.push_back(cue); };
+            ASSERT(wheel.advance(Timecode{ "10:00:00:02", F_25 }, on_fire) == 2);
+            ASSERT((fired == std::vector<int>{ 1, 2 }));
+
+            ASSERT(wheel.advance(Timecode{ "11:29:59:24", F_25 }, on_fire) == 1);
+            ASSERT(wheel.advance(Timecode{ "11:30:00:00", F_25 }, on_fire) == 1);
+            ASSERT((fired == std::vector<int>{ 1, 2, 3, 4 }));
+            ASSERT(wheel.empty());
+            ASSERT(wheel.now().to_string() == "11:30:00:00");
+        };
+
+        TEST("cancelled and past cues") {
+            auto wheel = TimecodeTimerWheel<std::string>{ Timecode{ "00:10:00;00", F_29P97_DF } };
+            auto const keep = wheel.schedule(Timecode{ "00:10:01;00", F_29P97_DF }, "keep");
+            auto const drop = wheel.schedule(Timecode{ "00:10:01;00", F_29P97_DF }, "drop");
+            wheel.schedule(Timecode{ "00:09:00;02", F_29P97_DF }, "late");
+
+            ASSERT(wheel.cancel(drop));
+            ASSERT(!wheel.cancel(drop));
+
+            auto fired = std::vector<std::string>{};
+            wheel.advance(Timecode{ "00:10:01;00", F_29P97_DF }, [&fired](std::string cue, Timecode const& due) {
+                fired.push_back(cue + "@" + due.to_string());
+            });
+            ASSERT((fired == std::vector<std::string>{ "late@00:09:00;02", "keep@00:10:01;00" }));
+            ASSERT(!wheel.cancel(keep));
+        };
+
+        TEST("on_fire cancels a cue due on the same frame") {
+            using Handle = TimecodeTimerWheel<int>::handle_type;
+            auto wheel = TimecodeTimerWheel<int>{ Timecode{ "00:00:00:00", F_25 } };
+            auto handles = std::array<Handle, 2>{};
+            handles[0] = wheel.schedule(Timecode{ "00:00:02:00", F_25 }, 0);
+            handles[1] = wheel.schedule(Timecode{ "00:00:02:00", F_25 }, 1);
+            wheel.schedule(Timecode{ "00:00:03:00", F_25 }, 2);
+
+            auto fired = std::vector<int>{};
+            auto const on_fire = [&](int cue, Timecode const&) {
+                fired.push_back(cue);
+                if (cue < 2) { ASSERT(wheel.cancel(handles[1 - cue])); }
+            };
+            ASSERT(wheel.advance(Timecode{ "00:00:02:00", F_25 }, on_fire) == 1);
+            ASSERT(fired.size() == 1);
+            ASSERT(wheel.empty() == false);
+
+            auto const reused = wheel.schedule(Timecode{ "00:00:02:10", F_25 }, 3);
+            ASSERT(wheel.size() == 2);
+            ASSERT(wheel.advance(Timecode{ "00:00:03:00", F_25 }, on_fire) == 2);
+            ASSERT((std::vector<int>{ fired.begin() + 1, fired.end() } == std::vector<int>{ 3, 2 }));
+            ASSERT(!wheel.cancel(reused));
+            ASSERT(wheel.empty());
+        };
+
+        TEST("cues on one frame fire in schedule order") {
+            auto wheel = TimecodeTimerWheel<int>{ Timecode{ "00:00:00:00", F_25 } };
+            for (auto cue = 0; cue < 4; ++cue) { wheel.schedule(Timecode{ "00:10:00:00", F_25 }, cue); }
+            wheel.schedule(Timecode{ "00:00:00:00", F_25 }, 4);
+            wheel.schedule(Timecode{ "00:00:00:00", F_25 }, 5);
+
+            auto fired = std::vector<int>{};
+            wheel.advance(Timecode{ "00:10:00:00", F_25 }, [&fired](int cue, Timecode const&) { fired.push_back(cue); });
+            ASSERT((fired == std::vector<int>{ 4, 5, 0, 1, 2, 3 }));
+        };
+
+        TEST("cues past the end of the day are rejected") {
+            auto wheel = TimecodeTimerWheel<int>{ Timecode{ "23:59:59:24", F_25 } };
+            auto const past_day = Timecode::from_ticks_unchecked(Timecode::TICKS_MAX(F_25) + 64 * TICK_RATE, F_25);
+            auto threw = false;
+            try { wheel.schedule(past_day, 0); } catch (std::runtime_error const&) { threw = true; }
+            ASSERT(threw);
+            ASSERT(wheel.empty());
+
+            threw = false;
+            try { TimecodeTimerWheel<int>{ past_day }; } catch (std::runtime_error const&) { threw = true; }
+            ASSERT(threw);
+        };
+
+        TEST("on_fire schedules new cues") {
+            auto wheel = TimecodeTimerWheel<int>{ Timecode{ "00:00:00:00", F_25 } };
+            wheel.schedule(Timecode{ "00:00:01:00", F_25 }, 0);
+            wheel.schedule(Timecode{ "00:00:01:00", F_25 }, 1);
+
+            auto fired = std::vector<int>{};
+            auto const on_fire = [&](int cue, Timecode const& due) {
+                fired.push_back(cue);
+                if (cue < 2) { wheel.schedule(Timecode::from_ticks_unchecked(due.ticks() + TICK_RATE * 10, F_25), cue + 2); }
+            };
+            ASSERT(wheel.advance(Timecode{ "00:00:01:00", F_25 }, on_fire) == 2);
+            ASSERT(wheel.size() == 2);
+            ASSERT(wheel.advance(Timecode{ "00:00:01:10", F_25 }, on_fire) == 2);
+            std::ranges::sort(fired);
+            ASSERT((fired == std::vector<int>{ 0, 1, 2, 3 }));
+            ASSERT(wheel.empty());
+        };
+    };
+
+    SECTION("ranges") {
+        TEST("odometer steps match decomposition") {
+            auto const start = Timecode{ "00:58:59;20", F_29P97_DF };
+            auto const end = Timecode{ "01:01:00;10", F_29P97_DF };
+            auto const range = timecode_range(start, end);
+            static_assert(std::ranges::forward_range<decltype(range)>);
+            static_assert(std::ranges::sized_range<decltype(range)>);
+
+            auto count = std::size_t{ 0 };
+            for (auto it = range.begin(); it != range.end(); ++it, ++count) {
+                ASSERT(it.parts() == (*it).parts());
+            }
+            ASSERT(count == range.size());
+            ASSERT(count == (end.ticks() - start.ticks()) / TICK_RATE);
+        };
+
+        TEST("steps and std::ranges algorithms") {
+            auto const range = timecode_range(Timecode{ "00:00:59:20", F_25 }, Timecode{ "00:01:00:10", F_25 }, 4);
+            ASSERT(range.size() == 4);
+
+            auto labels = std::vector<std::string>{};
+            std::ranges::transform(range, std::back_inserter(labels), [](Timecode const& tc) { return tc.to_string(); });
+            ASSERT((labels == std::vector<std::string>{ "00:00:59:20", "00:00:59:24", "00:01:00:03", "00:01:00:07" }));
+
+            auto buffer = std::array<char, Timecode::STRING_SIZE_REGULAR>{};
+            auto const last = std::ranges::next(range.begin(), 3);
+            last.format_to(buffer.data());
+            ASSERT((std::string_view{ buffer.data(), buffer.size() } == "00:01:00:07"));
+
+            ASSERT(timecode_range(Timecode{ "01:00:00:00", F_25 }, Timecode{ "00:00:00:00", F_25 }).empty());
+            ASSERT(std::ranges::distance(timecode_range(Timecode{ "00:00:00:00", F_24 }, Timecode{ "01:00:00:00", F_24 }, 24 * 60)) == 60);
+        };
+
+        TEST("labels use the drop-frame delimiter of the rate") {
+            auto const start = Timecode{ "00:00:59;23", F_23P976_DF };
+            auto const range = timecode_range(start, Timecode::from_ticks_unchecked(start.ticks() + 2 * TICK_RATE, F_23P976_DF));
+
+            auto buffer = std::array<char, Timecode::STRING_SIZE_REGULAR>{};
+            auto const second = std::ranges::next(range.begin());
+            second.format_to(buffer.data());
+            ASSERT((std::string_view{ buffer.data(), buffer.size() } == "00:01:00;00"));
+            ASSERT((std::string_view{ buffer.data(), buffer.size() } == (*second).to_string()));
+        };
+    };
+
+    SECTION("burn-in labels") {
+        TEST("labels roll over at the frame rate and skip dropped frames") {
+            auto generator = TimecodeLabelGenerator<>{ Timecode{ "00:00:59;28", F_29P97_DF } };
+            auto ring = std::array<TimecodeLabelGenerator<>::label_type, 3>{};
+
+            auto const next = generator.fill(ring, 1, 4);
+            ASSERT(next == 2);
+            auto const label = [&ring](std::size_t slot) { return std::string_view{ ring[slot].data(), ring[slot].size() }; };
+            ASSERT(label(0) == "00:01:00;02");
+            ASSERT(label(1) == "00:01:00;03");
+            ASSERT(label(2) == "00:00:59;29");
+            ASSERT(generator.label() == "00:01:00;04");
+            ASSERT(generator.current().to_string() == "00:01:00;04");
+        };
+
+        TEST("labels match formatting across a day") {
+            auto const start = Timecode{ "23:58:00;02", F_29P97_DF };
+            auto generator = TimecodeLabelGenerator<>{ start };
+            for (auto const& tc : timecode_range(start, Timecode{ "23:59:59;29", F_29P97_DF })) {
+                ASSERT(generator.label() == tc.to_string());
+                generator.advance();
+            }
+            generator.advance();
+            ASSERT(generator.label() == "00:00:00;00");
+
+            auto hourly = TimecodeLabelGenerator<>{ Timecode{ "09:59:59:24", F_25 } };
+            hourly.advance();
+            ASSERT(hourly.label() == "10:00:00:00");
+        };
+    };
+
+    SECTION("SMPTE 12M words") {
+        TEST("BCD time addresses") {
+            auto const tc = Timecode{ "12:34:56;28", F_29P97_DF };
+            ASSERT(tc.to_bcd() == 0x12345668u);
+            ASSERT(Timecode::from_bcd(0x12345668u, F_29P97_DF) == tc);
+            ASSERT((Timecode{ "23:59:59:24", F_25 }.to_bcd() == 0x23595924u));
+
+            ASSERT(!Timecode::from_bcd(0x12345628u, F_29P97_DF).has_value());
+            ASSERT(!Timecode::from_bcd(0x1234566Au, F_29P97_DF).has_value());
+            ASSERT(!Timecode::from_bcd(0x24000000u, F_25).has_value());
+            ASSERT(!Timecode::from_bcd(0x00010040u, F_29P97_DF).has_value());
+            ASSERT(Timecode::from_bcd(0x80808080u | 0x00010002u, F_25)->to_string() == "00:01:00:02");
+        };
+
+        TEST("LTC words carry sync, user bits and even parity") {
+            auto const tc = Timecode{ "10:20:30:12", F_25 };
+            auto const word = tc.to_ltc(0x89ABCDEFu);
+            ASSERT(word[8] == 0xFC && word[9] == 0xBF);
+            ASSERT(word[0] == 0xF2 && word[1] == 0xE1);
+            ASSERT(Timecode::ltc_user_bits(word) == 0x89ABCDEFu);
+
+            auto ones = 0;
+            for (auto const byte : word) { ones += std::popcount(byte); }
+            ASSERT(ones % 2 == 0);
+            ASSERT(Timecode::from_ltc(word, F_25) == tc);
+
+            auto broken = word;
+            broken[9] = 0;
+            ASSERT(!Timecode::from_ltc(broken, F_25).has_value());
+            ASSERT(((Timecode{ "01:00:00;02", F_29P97_DF }.to_ltc()[1] & 0x04) != 0));
+        };
+
+        TEST("batch BCD round trip") {
+            auto const start = Timecode{ "00:09:59;00", F_29P97_DF };
+            auto ticks = std::vector<std::uint32_t>{};
+            for (auto const& tc : timecode_range(start, Timecode{ "00:10:01;10", F_29P97_DF })) { ticks.push_back(tc.ticks()); }
+
+            auto bcds = std::vector<std::uint32_t>(ticks.size());
+            Timecode::ticks_to_bcds(ticks, F_29P97_DF, bcds);
+            for (std::size_t i = 0; i < ticks.size(); ++i) {
+                ASSERT(bcds[i] == Timecode::from_ticks_unchecked(ticks[i], F_29P97_DF).to_bcd());
+            }
+
+            bcds.push_back(0x00110040u);
+            auto decoded = std::vector<std::uint32_t>(bcds.size());
+            auto failed = std::vector<std::size_t>{};
+            ASSERT(Timecode::bcds_to_ticks(bcds, F_29P97_DF, decoded, failed) == ticks.size());
+            ASSERT((failed == std::vector<std::size_t>{ ticks.size() }));
+            ASSERT(std::equal(ticks.begin(), ticks.end(), decoded.begin()));
+        };
+    };
+
+    SECTION("LTC audio") {
+        TEST("float round trip at 48 kHz in uneven buffers") {
+            auto const start = Timecode{ "00:59:59;20", F_29P97_DF };
+            auto const end = Timecode{ "01:00:00;20", F_29P97_DF };
+            auto encoder = LtcEncoder<>{ F_29P97_DF, 48000 };
+            auto pcm = std::vector<float>{};
+            auto frame = std::vector<float>(encoder.max_frame_samples());
+            for (auto const& tc : timecode_range(start, end)) {
+                auto const written = encoder.encode(tc, std::span{ frame }, 0x1234u);
+                pcm.insert(pcm.end(), frame.begin(), frame.begin() + static_cast<std::ptrdiff_t>(written));
+            }
+            ASSERT(pcm.size() == 48048);
+
+            auto decoder = LtcDecoder<>{ F_29P97_DF, 48000 };
+            auto decoded = std::vector<std::string>{};
+            auto const on_frame = [&decoded](Timecode const& tc, std::uint32_t user_bits) {
+                if (user_bits == 0x1234u) { decoded.push_back(tc.to_string()); }
+            };
+            for (std::size_t i = 0; i < pcm.size(); i += 37) {
+                decoder.push(std::span{ pcm }.subspan(i, std::min<std::size_t>(37, pcm.size() - i)), on_frame);
+            }
+
+            auto expected = std::vector<std::string>{};
+            for (auto const& tc : timecode_range(start, end)) { expected.push_back(tc.to_string()); }
+            ASSERT(decoded == expected);
+        };
+
+        TEST("int16 round trip at 96 kHz") {
+            auto encoder = LtcEncoder<>{ F_25, 96000 };
+            auto decoder = LtcDecoder<>{ F_25, 96000 };
+            auto frame = std::vector<std::int16_t>(encoder.max_frame_samples());
+            auto count = std::size_t{ 0 };
+            auto last = std::string{};
+
+            for (auto const& tc : timecode_range(Timecode{ "10:00:00:00", F_25 }, Timecode{ "10:00:02:00", F_25 })) {
+                auto const written = encoder.encode(tc, std::span{ frame });
+                ASSERT(written == 96000 / 25);
+                count += decoder.push(std::span{ frame }.first(written), [&last](Timecode const& decoded, std::uint32_t) {
+                    last = decoded.to_string();
+                });
+            }
+            ASSERT(count == 50);
+            ASSERT(last == "10:00:01:24");
+        };
+    };
+
+    SECTION("real time") {
+        TEST("exact sample positions at fractional rates") {
+            auto const hour = Timecode{ "01:00:00;00", F_29P97_DF };
+            ASSERT(hour.to_samples(48000) == 172799827u);
+            ASSERT((Timecode{ "00:00:00;01", F_29P97_DF }.to_samples(48000, SnapMode::FLOOR) == 1601u));
+            ASSERT((Timecode{ "00:00:00;01", F_29P97_DF }.to_samples(48000, SnapMode::CEIL) == 1602u));
+            ASSERT(Timecode::from_samples(172799827u, 48000, F_29P97_DF) == hour);
+
+            auto const day = Timecode{ "23:59:59:23", F_23P976_NDF };
+            ASSERT(Timecode::from_samples(day.to_samples(96000), 96000, F_23P976_NDF) == day);
+            ASSERT(!Timecode::from_samples(std::uint64_t{ 96000 } * 90000, 96000, F_23P976_NDF).has_value());
+        };
+
+        TEST("exact durations") {
+            using namespace std::chrono_literals;
+            ASSERT((Timecode{ "00:00:01;00", F_29P97_DF }.to_duration() == 1001ms));
+            ASSERT((Timecode{ "00:10:00;00", F_29P97_DF }.to_duration<std::chrono::seconds>() == 600s));
+            ASSERT((Timecode{ "00:00:00:01", F_24 }.to_duration<std::chrono::microseconds>() == 41667us));
+            ASSERT(Timecode::from_duration(3600s, F_25)->to_string() == "01:00:00:00");
+            ASSERT(Timecode::from_duration(1001ms, F_23P976_NDF)->to_string() == "00:00:01:00");
+            ASSERT(!Timecode::from_duration(-1ns, F_25).has_value());
+            ASSERT(!Timecode::from_duration(std::chrono::hours{ 25 }, F_25).has_value());
+        };
+
+        TEST("batch conversions over columns") {
+            auto const column = TimecodeColumn<std::uint32_t>{ F_29P97_DF, std::vector<std::uint32_t>{ 0, 1000, 30000, 17982000 } };
+            auto samples = std::vector<std::uint64_t>(column.size());
+            column.to_samples(48000, samples);
+            ASSERT((samples == std::vector<std::uint64_t>{ 0, 1602, 48048, 28799971 }));
+
+            samples.push_back(std::uint64_t{ 48000 } * 86400 * 2);
+            auto rejected = std::vector<std::size_t>{};
+            auto const back = TimecodeColumn<std::uint32_t>::from_samples(samples, 48000, F_29P97_DF, rejected);
+            ASSERT((rejected == std::vector<std::size_t>{ 4 }));
+            ASSERT(std::ranges::equal(back.ticks(), column.ticks()));
+
+            auto durations = std::vector<std::chrono::nanoseconds>(column.size());
+            column.to_durations(std::span{ durations });
+            ASSERT(durations[2] == std::chrono::nanoseconds{ 1'001'000'000 });
+            auto const again = TimecodeColumn<std::uint32_t>::from_durations(std::span<std::chrono::nanoseconds const>{ durations }, F_29P97_DF, rejected);
+            ASSERT(std::ranges::equal(again.ticks(), column.ticks()));
+        };
+    };
+
+    SECTION("parse errors") {
+        TEST("reasons for failed parses") {
+            ASSERT((Timecode::parse_ticks("01:00:00:00", F_25).value() == Timecode{ "01:00:00:00", F_25 }.ticks()));
+            ASSERT(Timecode::parse_ticks("01:00:00:0", F_25).error() == ParseError::BAD_LENGTH);
+            ASSERT(Timecode::parse_ticks("01:0a:00:00", F_25).error() == ParseError::NOT_A_DIGIT);
+            ASSERT(Timecode::parse_ticks("01:00:00:00.5x0", F_25).error() == ParseError::NOT_A_DIGIT);
+            ASSERT(Timecode::parse_ticks("01-00:00:00", F_25).error() == ParseError::BAD_DELIMITER);
+            ASSERT(Timecode::parse_ticks("01:00:00:00,500", F_25).error() == ParseError::BAD_DELIMITER);
+            ASSERT(Timecode::parse_ticks("01:60:00:00", F_25).error() == ParseError::OUT_OF_RANGE);
+            ASSERT(Timecode::parse_ticks("01:00:00:25", F_25).error() == ParseError::OUT_OF_RANGE);
+            ASSERT(Timecode::parse_ticks("01:01:00;00", F_29P97_DF).error() == ParseError::DROPPED_FRAME);
+            ASSERT(Timecode::parse_ticks("01:00:00:00", static_cast<Fps::Variant>(7)).error() == ParseError::UNKNOWN_RATE);
+            static_assert(noexcept(Timecode::parse_ticks("", F_25)));
+        };
+
+        TEST("timecodes and messages") {
+            auto const tc = Timecode::parse("10:00:00;02", F_29P97_DF);
+            ASSERT(tc.has_value());
+            ASSERT(tc->to_string() == "10:00:00;02");
+            ASSERT(Timecode::parse("24:00:00:01", F_25).error() == ParseError::OUT_OF_RANGE);
+            ASSERT(std::format("{}", ParseError::DROPPED_FRAME) == "dropped frame label");
+            ASSERT(!Timecode::from_string("00:00:00:00", static_cast<Fps::Variant>(7)).has_value());
+
+            auto message = std::string{};
+            try { Timecode{ "01:00:00:30", F_30 }; } catch (std::runtime_error const& error) { message = error.what(); }
+            ASSERT(message.ends_with(": field out of range"));
+        };
+    };
 }